@@ -35,12 +35,25 @@ NS_START(cosm, arena);
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
+/**
+ * \brief Which of the arena map locks are held by the caller of an operation,
+ * and how the operation should acquire the ones that are not.
+ *
+ * - \ref ekGRID_TILED - If the grid is not held, lock only the tiles of the
+ *   grid an operation touches (see \ref cds::arena_grid::region_lock())
+ *   rather than the whole grid, and take the block mutex in shared rather than
+ *   exclusive mode, so that operations in distant parts of the arena can
+ *   proceed in parallel. Operations which can touch any part of the grid or
+ *   any block (e.g. block distribution) still lock the whole grid/block mutex
+ *   exclusively, excluding all tiled operations.
+ */
 enum class arena_map_locking {
   ekNONE_HELD = 1 << 0,
   ekBLOCKS_HELD = 1 << 1,
   ekCACHES_HELD = 1 << 2,
   ekGRID_HELD = 1 << 3,
-  ekALL_HELD = ekNONE_HELD | ekBLOCKS_HELD | ekCACHES_HELD | ekGRID_HELD
+  ekALL_HELD = ekNONE_HELD | ekBLOCKS_HELD | ekCACHES_HELD | ekGRID_HELD,
+  ekGRID_TILED = 1 << 4
 };
 NS_END(arena, cosm);
 
@@ -25,8 +25,10 @@
  * Includes
  ******************************************************************************/
 #include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <string>
+#include <utility>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/patterns/decorator/decorator.hpp"
@@ -167,6 +169,11 @@ class base_arena_map : public rer::client<base_arena_map<TBlockType>>,
    * block or not, there are some false positives, so this function is used as
    * the final arbiter when deciding whether or not to trigger a given event.
    *
+   * The cells of the arena grid near the robot are searched, rather than all
+   * blocks, so the cost of this function does not depend on the # of blocks in
+   * the arena. The tiles of the grid containing those cells are locked during
+   * the search, so it must not be called with any part of the grid held.
+   *
    * \param pos The position of a robot.
    * \param ent_id The ID of the block the robot THINKS it is on.
    *
@@ -174,7 +181,7 @@ class base_arena_map : public rer::client<base_arena_map<TBlockType>>,
    * actually on a block.
    */
   virtual rtypes::type_uuid robot_on_block(const rmath::vector2d& pos,
-                                           const rtypes::type_uuid& ent_id) const RCSW_PURE;
+                                           const rtypes::type_uuid& ent_id) const;
 
   /**
    * \brief Get the subgrid for use in calculating a robot's LOS.
@@ -204,6 +211,32 @@ class base_arena_map : public rer::client<base_arena_map<TBlockType>>,
     return m_block_dispatcher.distributor();
   }
 
+  /**
+   * \brief Update the block clusters (if any) after the block with the
+   * specified ID has been picked up from the specified cell.
+   *
+   * Should be called with (at least) the tile of the grid containing the cell
+   * locked, and the block mutex held. The clusters are protected by their own
+   * mutex, which is only held for the update, as tiled drops in different
+   * parts of the arena only hold the block mutex shared.
+   */
+  void clusters_update_after_pickup(const rtypes::type_uuid& id,
+                                    const rmath::vector2z& coord) {
+    std::scoped_lock lock(m_cluster_mtx);
+    m_block_dispatcher.distributor()->clusters_update_after_pickup(id, coord);
+  }
+
+  /**
+   * \brief Update the block clusters (if any) after a block has been dropped
+   * in the arena outside of block distribution.
+   *
+   * Same locking requirements as \ref clusters_update_after_pickup().
+   */
+  void clusters_update_after_drop(const TBlockType* block) {
+    std::scoped_lock lock(m_cluster_mtx);
+    m_block_dispatcher.distributor()->clusters_update_after_drop(block);
+  }
+
   const rmath::ranged& distributable_areax(void) const {
     return m_block_dispatcher.distributable_areax();
   }
@@ -233,23 +266,100 @@ class base_arena_map : public rer::client<base_arena_map<TBlockType>>,
    */
   bool initialize(cpal::argos_sm_adaptor* sm, rmath::rng* rng);
 
-  void maybe_lock(std::mutex* mtx, bool cond) {
+  template<typename TMutexType>
+  void maybe_lock(TMutexType* mtx, bool cond) {
     if (cond) {
       mtx->lock();
     }
   }
-  void maybe_unlock(std::mutex* mtx, bool cond) {
+  template<typename TMutexType>
+  void maybe_unlock(TMutexType* mtx, bool cond) {
     if (cond) {
       mtx->unlock();
     }
   }
 
-  std::mutex* grid_mtx(void) { return decoratee().mtx(); }
+  /**
+   * \brief Protects the arena grid as a whole. See \ref cds::arena_grid::mtx().
+   */
+  std::shared_mutex* grid_mtx(void) { return decoratee().mtx(); }
 
   /**
-   * \brief Protects simultaneous updates to the blocks vector.
+   * \brief Lock/unlock only the tiles of the arena grid covering the specified
+   * (inclusive) region. See \ref cds::arena_grid::region_lock().
    */
-  std::mutex* block_mtx(void) { return &m_block_mtx; }
+  void grid_region_lock(const rmath::vector2z& ll,
+                        const rmath::vector2z& ur) const {
+    decoratee().region_lock(ll, ur);
+  }
+  void grid_region_unlock(const rmath::vector2z& ll,
+                          const rmath::vector2z& ur) const {
+    decoratee().region_unlock(ll, ur);
+  }
+
+  /**
+   * \brief Lock/unlock the arena grid for an operation on a single cell, as
+   * specified by \p locking: nothing if the grid is already held, only the
+   * tile containing the cell if \ref arena_map_locking::ekGRID_TILED is set,
+   * and the whole grid otherwise.
+   */
+  void maybe_lock_cell(const rmath::vector2z& coord,
+                       const arena_map_locking& locking) {
+    if (!(locking & arena_map_locking::ekGRID_HELD)) {
+      if (!!(locking & arena_map_locking::ekGRID_TILED)) {
+        grid_region_lock(coord, coord);
+      } else {
+        grid_mtx()->lock();
+      }
+    }
+  }
+  void maybe_unlock_cell(const rmath::vector2z& coord,
+                         const arena_map_locking& locking) {
+    if (!(locking & arena_map_locking::ekGRID_HELD)) {
+      if (!!(locking & arena_map_locking::ekGRID_TILED)) {
+        grid_region_unlock(coord, coord);
+      } else {
+        grid_mtx()->unlock();
+      }
+    }
+  }
+
+  /**
+   * \brief Lock/unlock the block mutex, as specified by \p locking: nothing if
+   * it is already held, shared if \ref arena_map_locking::ekGRID_TILED is set,
+   * and exclusively otherwise.
+   *
+   * Tiled operations only modify blocks they own (e.g. a block being dropped
+   * by a robot) and the cells in the tiles they hold, so they can share the
+   * block mutex with each other, but not with anything reading/writing blocks
+   * anywhere in the arena (e.g. block distribution, \ref
+   * cforaging::oracle::foraging_oracle updates), which lock it exclusively.
+   */
+  void maybe_lock_blocks(const arena_map_locking& locking) {
+    if (!(locking & arena_map_locking::ekBLOCKS_HELD)) {
+      if (!!(locking & arena_map_locking::ekGRID_TILED)) {
+        block_mtx()->lock_shared();
+      } else {
+        block_mtx()->lock();
+      }
+    }
+  }
+  void maybe_unlock_blocks(const arena_map_locking& locking) {
+    if (!(locking & arena_map_locking::ekBLOCKS_HELD)) {
+      if (!!(locking & arena_map_locking::ekGRID_TILED)) {
+        block_mtx()->unlock_shared();
+      } else {
+        block_mtx()->unlock();
+      }
+    }
+  }
+
+  /**
+   * \brief Protects simultaneous updates to the blocks vector. Locked
+   * exclusively by everything except operations using \ref
+   * arena_map_locking::ekGRID_TILED; see \ref maybe_lock_blocks().
+   */
+  std::shared_mutex* block_mtx(void) { return &m_block_mtx; }
 
  protected:
   struct block_dist_precalc_type {
@@ -270,20 +380,37 @@ class base_arena_map : public rer::client<base_arena_map<TBlockType>>,
 
   /**
    * \brief Calculate the list of entities that need to be avoided during block
-   * distribution.
+   * distribution which are not referenced by the arena grid. Blocks and caches
+   * are avoided via the grid, and so are not included (except caches during
+   * initial distribution), making this O(1) w.r.t. the # of blocks.
    *
    * \param block The block to distribute. If NULL, then this is the initial
    *              block distribution.
    */
   virtual block_dist_precalc_type block_dist_precalc(const TBlockType* block);
 
+  /**
+   * \brief Compute the (inclusive) lower left and upper right corners of the
+   * window of cells which could host an entity containing the specified
+   * point. This makes the arena grid usable as a spatial index for point
+   * queries, as every block/cache is referenced by its host cell.
+   *
+   * \param pos The point to query.
+   * \param dims The maximum dimensions of the entities of interest.
+   */
+  std::pair<rmath::vector2z, rmath::vector2z> host_cell_search_bounds(
+      const rmath::vector2d& pos,
+      const rmath::vector2d& dims) const;
+
  private:
   /* clang-format off */
   mutable std::mutex                            m_cache_mtx{};
-  mutable std::mutex                            m_block_mtx{};
+  mutable std::shared_mutex                     m_block_mtx{};
+  std::mutex                                    m_cluster_mtx{};
 
   block_vectoro_type                            m_blockso;
   block_vectorno_type                           m_blocksno{};
+  rmath::vector2d                               m_max_block_dims{};
   crepr::nest                                   m_nest;
   cforaging::block_dist::dispatcher<TBlockType> m_block_dispatcher;
   cforaging::block_dist::redist_governor        m_redist_governor;
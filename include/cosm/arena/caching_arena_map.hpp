@@ -27,6 +27,7 @@
 #include <mutex>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include "cosm/arena/base_arena_map.hpp"
 #include "cosm/arena/ds/cache_vector.hpp"
@@ -49,6 +50,10 @@ NS_START(cosm, arena);
  * \ingroup ds
  *
  * \brief Decorates \ref base_arena_map to add the ability to manage caches.
+ *
+ * Caches are indexed by ID, so looking up, adding, and removing caches are all
+ * O(1) regardless of how many caches have been created/depleted. Cache IDs are
+ * never reused, so a stale ID will never refer to a different cache.
  */
 class caching_arena_map final : public rer::client<caching_arena_map>,
                                 public base_arena_map<crepr::base_block2D> {
@@ -57,9 +62,8 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
 
   /**
    * \brief Get the list of all the caches currently present in the arena and
-   * active.
+   * active. The order of caches in the list changes as caches are removed.
    */
-  cads::acache_vectorno& caches(void) { return m_cachesno; }
   const cads::acache_vectorno& caches(void) const { return m_cachesno; }
 
   /**
@@ -69,7 +73,8 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
 
   /**
    * \brief Add caches that have been created (by a cache manager or by robots)
-   * in the arena to the current set of active caches.
+   * in the arena to the current set of active caches. Caches with the same ID
+   * as a cache already present are not added.
    *
    * \param caches The caches to add.
    * \param sm The \ref argos_sm_adaptor.
@@ -96,6 +101,10 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
    * the final arbiter when deciding whether or not to trigger a cache related
    * event for a particular robot.
    *
+   * Like \ref base_arena_map::robot_on_block(), falls back to searching the
+   * cells near the robot rather than all caches, locking the tiles of the grid
+   * containing them.
+   *
    * \param pos The position of a robot.
    * \param ent_id The ID of the cache the robot THINKS it is on.
    *
@@ -103,10 +112,10 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
    * actually on a cache.
    */
   rtypes::type_uuid robot_on_cache(const rmath::vector2d& pos,
-                                   const rtypes::type_uuid& ent_id) const RCSW_PURE;
+                                   const rtypes::type_uuid& ent_id) const;
 
   rtypes::type_uuid robot_on_block(const rmath::vector2d& pos,
-                                   const rtypes::type_uuid& ent_id) const override RCSW_PURE;
+                                   const rtypes::type_uuid& ent_id) const override;
   /**
    * \brief Protects simultaneous updates to the caches vector.
    */
@@ -134,7 +143,13 @@ class caching_arena_map final : public rer::client<caching_arena_map>,
 
   cads::acache_vectoro                   m_cacheso{};
   cads::acache_vectorno                  m_cachesno{};
+
+  /**
+   * \brief Cache ID -> position in \ref m_cacheso and \ref m_cachesno.
+   */
+  std::unordered_map<int, size_t>        m_cache_index{};
   cads::acache_vectoro                   m_zombie_caches{};
+  rmath::vector2d                        m_max_cache_dims{};
   /* clang-format on */
 };
 
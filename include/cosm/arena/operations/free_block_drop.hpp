@@ -44,6 +44,10 @@ template<typename T>
 class base_arena_map;
 } /* namespace cosm::arena */
 
+namespace cosm::arena::repr {
+class arena_cache;
+} /* namespace cosm::arena::repr */
+
 NS_START(cosm, arena, operations, detail);
 
 /*******************************************************************************
@@ -134,6 +138,21 @@ class free_block_drop : public rer::client<free_block_drop<TBlockType>>,
  private:
   void visit(fsm::cell2D_fsm& fsm);
 
+  /**
+   * \brief Redistribute the block being dropped because the drop cell is not
+   * suitable, while holding the grid/block locks in whatever mode \ref
+   * mc_locking specified.
+   */
+  template<typename TMapType, typename TDistBlockType>
+  void redistribute(TMapType& map, TDistBlockType* block);
+
+  /**
+   * \brief Drop the block into the cache whose extent contains the drop cell,
+   * while holding the cache mutex, and the grid/block locks in whatever mode
+   * \ref mc_locking specified.
+   */
+  void cache_drop(caching_arena_map& map, carepr::arena_cache* cache);
+
   /* clang-format off */
   const rtypes::discretize_ratio mc_resolution;
   const arena_map_locking        mc_locking;
@@ -73,8 +73,8 @@ class free_block_pickup : public rer::client<free_block_pickup>,
    * \brief Perform actual block pickup in the arena.
    *
    * Takes \ref arena_map grid mutex to protect block re-distribution and block
-   * updates. \ref arena_map block mutex assumed to be held when calling this
-   * function.
+   * updates. \ref arena_map block mutex assumed to be held (exclusively) when
+   * calling this function.
    */
   template<typename TBlockType>
   void visit(base_arena_map<TBlockType>& map);
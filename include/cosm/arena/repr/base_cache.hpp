@@ -28,6 +28,7 @@
 #include <memory>
 #include <vector>
 
+#include "rcppsw/er/client.hpp"
 #include "rcppsw/patterns/prototype/clonable.hpp"
 #include "rcppsw/types/spatial_dist.hpp"
 
@@ -35,6 +36,7 @@
 #include "cosm/repr/colored_entity.hpp"
 #include "cosm/repr/unicell_immovable_entity2D.hpp"
 
+#include "cosm/ds/block2D_fifo.hpp"
 #include "cosm/ds/block2D_vector.hpp"
 
 /*******************************************************************************
@@ -54,10 +56,14 @@ NS_START(cosm, arena, repr);
  * enclosing class. Caches have both real (where they actually live in the
  * world) and discretized locations (where they are mapped to within the arena
  * map).
+ *
+ * Blocks are kept in the order they were added, so that picking up the oldest
+ * block, adding a block, and checking if a block is in the cache are all O(1).
  */
 class base_cache : public crepr::unicell_immovable_entity2D,
                    public crepr::colored_entity,
-                   public rpprototype::clonable<base_cache> {
+                   public rpprototype::clonable<base_cache>,
+                   public rer::client<base_cache> {
  public:
   /**
    * \param dimension The size of the cache. Does not have to be a multiple of
@@ -118,25 +124,24 @@ class base_cache : public crepr::unicell_immovable_entity2D,
     return contains_block(c_block.get());
   }
   RCSW_PURE bool contains_block(const crepr::base_block2D* const c_block) const {
-    return std::find_if(m_blocks.begin(), m_blocks.end(), [&](const auto& b) {
-             return b->id() == c_block->id();
-           }) != m_blocks.end();
+    return m_blocks.contains(c_block->id());
   }
   size_t n_blocks(void) const { return blocks().size(); }
 
   /**
-   * \brief Get a list of the blocks currently in the cache.
+   * \brief Get the blocks currently in the cache, oldest first.
    */
-  cds::block2D_vectorno& blocks(void) { return m_blocks; }
-  const cds::block2D_vectorno& blocks(void) const { return m_blocks; }
+  const cds::block2D_fifo& blocks(void) const { return m_blocks; }
 
   /**
-   * \brief Add a new block to the cache's list of blocks.
+   * \brief Add a new block to the cache's list of blocks. The block must not
+   * already be in the cache.
    *
    * Does not update the block's location.
    */
   void block_add(crepr::base_block2D* block) {
-    m_blocks.push_back(block);
+    RCSW_UNUSED bool added = m_blocks.push_back(block);
+    ER_ASSERT(added, "Block%d already in cache%d", block->id().v(), id().v());
   }
 
   /**
@@ -154,6 +159,13 @@ class base_cache : public crepr::unicell_immovable_entity2D,
     return m_blocks.front();
   }
 
+  /**
+   * \brief Clone the cache. The clone shares the block list with this cache
+   * until either of them is modified, so cloning does not copy it. As with
+   * \ref cds::block2D_fifo, the cache and its clones must therefore not be
+   * cloned or have blocks added/removed concurrently: for arena caches, clone
+   * while holding the arena map's cache mutex.
+   */
   std::unique_ptr<base_cache> clone(void) const override final;
 
   rtypes::timestep creation_ts(void) const { return m_creation; }
@@ -166,7 +178,7 @@ class base_cache : public crepr::unicell_immovable_entity2D,
   static int                     m_next_id;
 
   rtypes::timestep               m_creation{0};
-  cds::block2D_vectorno          m_blocks;
+  cds::block2D_fifo              m_blocks;
   /* clang-format on */
 };
 
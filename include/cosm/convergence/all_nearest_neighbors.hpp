@@ -0,0 +1,69 @@
+/**
+ * \file all_nearest_neighbors.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONVERGENCE_ALL_NEAREST_NEIGHBORS_HPP_
+#define INCLUDE_COSM_CONVERGENCE_ALL_NEAREST_NEIGHBORS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/rcppsw.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class all_nearest_neighbors
+ * \ingroup convergence
+ *
+ * \brief Computes the distance from each point in a set to its nearest
+ * neighbor in the set (the all-nearest-neighbors problem), for use in
+ * calculating swarm \ref interactivity.
+ *
+ * The points are binned into a uniform grid sized so that each cell contains
+ * ~1 point on average, and then each point searches outward from its own cell
+ * in square rings until no unsearched cell can contain a closer point. For
+ * swarms which are not pathologically clustered this is O(n) per call, and
+ * the queries are independent, so they are run in parallel.
+ */
+class all_nearest_neighbors {
+ public:
+  /**
+   * \param pts The set of points.
+   * \param n_threads How many threads to use for the queries.
+   *
+   * \return The distance of each point to its nearest neighbor, in the same
+   * order as the input points. Empty if there are < 2 points.
+   */
+  std::vector<double> operator()(const std::vector<rmath::vector2d>& pts,
+                                 uint n_threads) const;
+};
+
+NS_END(convergence, cosm);
+
+#endif /* INCLUDE_COSM_CONVERGENCE_ALL_NEAREST_NEIGHBORS_HPP_ */
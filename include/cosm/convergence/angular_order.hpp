@@ -24,12 +24,14 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
 #include <vector>
 
 #include "rcppsw/math/radians.hpp"
 #include "rcppsw/rcppsw.hpp"
 
 #include "cosm/convergence/convergence_measure.hpp"
+#include "cosm/convergence/swarm_reductions.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -58,16 +60,13 @@ class angular_order final : public convergence_measure {
    * parameters and the current state of the swarm.
    */
   bool operator()(const std::vector<rmath::radians>& headings,
-                  RCSW_UNUSED uint n_threads) {
-    double y = 0.0;
-    double x = 0.0;
-
-#pragma omp parallel for num_threads(n_threads)
-    for (auto it = headings.begin(); it < headings.end(); ++it) {
-      y += std::sin((*it).value());
-      x += std::cos((*it).value());
-    } /* for(it..) */
-    update_raw(std::fabs(std::atan2(y, x)) / headings.size());
+                  uint n_threads) {
+    auto sum = swarm_sum2D(
+        headings.size(),
+        n_threads,
+        [&](size_t i) { return std::cos(headings[i].value()); },
+        [&](size_t i) { return std::sin(headings[i].value()); });
+    update_raw(std::fabs(std::atan2(sum.y(), sum.x())) / headings.size());
     set_norm(rmath::normalize(raw_min(), raw_max(), raw()));
     return update_convergence_state();
   }
@@ -36,6 +36,7 @@
 #include "cosm/convergence/interactivity.hpp"
 #include "cosm/convergence/metrics/convergence_metrics.hpp"
 #include "cosm/convergence/positional_entropy.hpp"
+#include "cosm/convergence/swarm_snapshot.hpp"
 #include "cosm/convergence/task_dist_entropy.hpp"
 #include "cosm/convergence/velocity.hpp"
 
@@ -54,7 +55,7 @@ NS_START(cosm, convergence);
  * \brief Convenience class for managing calculation of swarm convergence using
  * any enabled methods.
  *
- * Takes a set of optional callbacks for during construction for calculating the
+ * Takes a set of optional callbacks for during construction for gathering the
  * various quantities needed for convergence calculations (if a specific type of
  * convergence calculation is enabled, then you obviously need to pass a valid
  * callback to calculate the necessary input data).
@@ -64,34 +65,15 @@ class convergence_calculator final
       public rer::client<convergence_calculator> {
  public:
   /**
-   * \brief Callback function that returns a vector of robot headings (1 per
-   * robot). Used to calculate swarm angular order.
+   * \brief Callback function that fills a \ref swarm_snapshot with the current
+   * state of the swarm (1 entry per robot). Called at most once per timestep,
+   * and the result is used to calculate swarm angular order, interactivity,
+   * positional entropy, and velocity.
    *
-   * Takes a single integer argument specifying the # OpenMP threads to be
-   * used, per configuration.
+   * Takes the snapshot to fill and a single integer argument specifying the #
+   * OpenMP threads to be used, per configuration.
    */
-  using headings_calc_cb_type = std::function<std::vector<rmath::radians>(uint)>;
-
-  /**
-   * \brief Callback function that returns a vector of nearest neighbor
-   * distances (1 per robot). Used to calculate swarm interactivity.
-   *
-   * Takes a single integer argument specifying the # OpenMP threads to be
-   * used, per configuration.
-   */
-  using nn_calc_cb_type = std::function<std::vector<double>(uint)>;
-
-  /**
-   * \brief Callback function that returns a vector of robot positions (1 per
-   * robot). Used to calculate swarm positional entropy and velocity (SEPARATE
-   * calls per timestep). The calling application should cache the results of
-   * the computation passed to the calculator internally if separate calls to
-   * obtain the positions of each robot is expensive.
-   *
-   * Takes a single integer argument specifying the # OpenMP threads to be
-   * used, per configuration.
-   */
-  using pos_calc_cb_type = std::function<std::vector<rmath::vector2d>(uint)>;
+  using snapshot_calc_cb_type = std::function<void(swarm_snapshot*, uint)>;
 
   /**
    * \brief Callback function that returns a vector of robot tasks (as unique
@@ -117,18 +99,24 @@ class convergence_calculator final
   void reset_metrics(void) override;
 
   /**
-   * \brief Set the callback for calculating \ref angular_order. In order to
-   * actually calculate it time \ref update is called, it must have also been
-   * enabled in configuration.
+   * \brief Set the callback for gathering the \ref swarm_snapshot used by all
+   * measures other than \ref task_dist_entropy.
    */
-  void angular_order_init(const headings_calc_cb_type& cb);
+  void snapshot_init(const snapshot_calc_cb_type& cb);
 
   /**
-   * \brief Set the callback for calculating \ref interactivity. In order to
-   * actually calculate it time \ref update is called, it must have also been
-   * enabled in configuration.
+   * \brief Enable calculating \ref angular_order from the \ref
+   * swarm_snapshot. In order to actually calculate it time \ref update is
+   * called, it must have also been enabled in configuration.
    */
-  void interactivity_init(const nn_calc_cb_type& cb);
+  void angular_order_init(void);
+
+  /**
+   * \brief Enable calculating \ref interactivity from the \ref
+   * swarm_snapshot. In order to actually calculate it time \ref update is
+   * called, it must have also been enabled in configuration.
+   */
+  void interactivity_init(void);
 
   /**
    * \brief Set the callback for calculating \ref task_dist_entropy. In order to
@@ -138,18 +126,18 @@ class convergence_calculator final
   void task_dist_entropy_init(const tasks_calc_cb_type& cb);
 
   /**
-   * \brief Set the callback for calculating \ref positional_entropy. In order
-   * to actually calculate it time \ref update is called, it must have also been
-   * enabled in configuration.
+   * \brief Enable calculating \ref positional_entropy from the \ref
+   * swarm_snapshot. In order to actually calculate it time \ref update is
+   * called, it must have also been enabled in configuration.
    */
-  void positional_entropy_init(const pos_calc_cb_type& cb);
+  void positional_entropy_init(void);
 
   /**
-   * \brief Set the callback for calculating \ref velocity. In order to
-   * actually calculate it time \ref update is called, it must have also been
-   * enabled in configuration.
+   * \brief Enable calculating \ref velocity from the \ref swarm_snapshot. In
+   * order to actually calculate it time \ref update is called, it must have
+   * also been enabled in configuration.
    */
-  void velocity_init(const pos_calc_cb_type& cb);
+  void velocity_init(void);
 
   /**
    * \brief Return swarm convergence status in an OR fashion (i.e. if ANY of the
@@ -172,10 +160,9 @@ class convergence_calculator final
   const config::convergence_config       mc_config;
 
   rds::type_map<measure_typelist>        m_measures{};
-  boost::optional<headings_calc_cb_type> m_headings_calc{nullptr};
-  boost::optional<nn_calc_cb_type>       m_nn_calc{nullptr};
-  boost::optional<pos_calc_cb_type>      m_pos_calc{nullptr};
+  boost::optional<snapshot_calc_cb_type> m_snapshot_calc{nullptr};
   boost::optional<tasks_calc_cb_type>    m_tasks_calc{nullptr};
+  swarm_snapshot                         m_snapshot{};
   /* clang-format on */
 };
 
@@ -0,0 +1,69 @@
+/**
+ * \file swarm_reductions.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONVERGENCE_SWARM_REDUCTIONS_HPP_
+#define INCLUDE_COSM_CONVERGENCE_SWARM_REDUCTIONS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/rcppsw.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Free Functions
+ ******************************************************************************/
+/**
+ * \brief Compute the component-wise sum of \p n 2D values, where the X and Y
+ * components of the i-th value are given by \p xfunc(i) and \p yfunc(i).
+ *
+ * The X and Y sums are separate scalar OpenMP reductions, so each thread
+ * accumulates privately, and the loop body is simple enough to vectorize when
+ * the functions read from contiguous per-component (struct-of-arrays) buffers.
+ *
+ * \param n How many values to sum.
+ * \param n_threads How many threads to use.
+ */
+template <typename TXFunc, typename TYFunc>
+rmath::vector2d swarm_sum2D(size_t n,
+                            RCSW_UNUSED uint n_threads,
+                            const TXFunc& xfunc,
+                            const TYFunc& yfunc) {
+  double x = 0.0;
+  double y = 0.0;
+
+#pragma omp parallel for simd reduction(+ : x, y) num_threads(n_threads)
+  for (size_t i = 0; i < n; ++i) {
+    x += xfunc(i);
+    y += yfunc(i);
+  } /* for(i..) */
+  return {x, y};
+} /* swarm_sum2D() */
+
+NS_END(convergence, cosm);
+
+#endif /* INCLUDE_COSM_CONVERGENCE_SWARM_REDUCTIONS_HPP_ */
@@ -0,0 +1,77 @@
+/**
+ * \file swarm_snapshot.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_CONVERGENCE_SWARM_SNAPSHOT_HPP_
+#define INCLUDE_COSM_CONVERGENCE_SWARM_SNAPSHOT_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "rcppsw/math/radians.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/rcppsw.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct swarm_snapshot
+ * \ingroup convergence
+ *
+ * \brief The state of each robot in the swarm at a given instant which is
+ * needed by the \ref convergence_measure classes, gathered once per timestep
+ * and shared by all of them.
+ *
+ * Stored as one array per quantity, indexed by robot (robot i has ids[i],
+ * positions[i], headings[i]), so that each measure can operate directly on the
+ * contiguous array(s) it needs. The snapshot is reused across timesteps, so
+ * that after the first timestep gathering it does not allocate.
+ */
+struct swarm_snapshot {
+  /**
+   * \brief Set the # of robots in the snapshot, (re)allocating only if the
+   * swarm has grown.
+   */
+  void resize(size_t n) {
+    ids.resize(n, rtypes::constants::kNoUUID);
+    positions.resize(n);
+    headings.resize(n);
+  }
+
+  size_t size(void) const { return ids.size(); }
+
+  /* clang-format off */
+  std::vector<rtypes::type_uuid> ids{};
+  std::vector<rmath::vector2d>   positions{};
+  std::vector<rmath::radians>    headings{};
+  /* clang-format on */
+};
+
+NS_END(convergence, cosm);
+
+#endif /* INCLUDE_COSM_CONVERGENCE_SWARM_SNAPSHOT_HPP_ */
@@ -24,13 +24,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <numeric>
 #include <vector>
 
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/rcppsw.hpp"
 
 #include "cosm/convergence/convergence_measure.hpp"
+#include "cosm/convergence/swarm_reductions.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -54,10 +54,13 @@ class velocity final : public convergence_measure {
   /*
    * \brief Compute the velocity.
    */
-  bool operator()(const std::vector<rmath::vector2d>& locs) {
-    rmath::vector2d center =
-        std::accumulate(locs.begin(), locs.end(), rmath::vector2d()) /
-        locs.size();
+  bool operator()(const std::vector<rmath::vector2d>& locs, uint n_threads) {
+    rmath::vector2d center = swarm_sum2D(
+                                 locs.size(),
+                                 n_threads,
+                                 [&](size_t i) { return locs[i].x(); },
+                                 [&](size_t i) { return locs[i].y(); }) /
+                             locs.size();
     update_raw((center - m_prev_center).length());
     set_norm(rmath::normalize(raw_min(), raw_max(), raw()));
     m_prev_center = center;
@@ -24,8 +24,12 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
 #include <mutex>
+#include <shared_mutex>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "rcppsw/ds/stacked_grid2D.hpp"
 #include "rcppsw/types/discretize_ratio.hpp"
@@ -59,6 +63,12 @@ class arena_grid : public rds::stacked_grid2D<arena_layer_stack> {
 
   static constexpr const size_t kCell = 0;
 
+  /**
+   * \brief The size (in cells) of each side of the square tiles the grid is
+   * divided into for locking.
+   */
+  static constexpr const size_t kLockTileDim = 16;
+
   /**
    * \param resolution The arena resolution (i.e. what is the size of 1 cell in
    *                   the 2D grid).
@@ -69,7 +79,10 @@ class arena_grid : public rds::stacked_grid2D<arena_layer_stack> {
    */
   arena_grid(const rmath::vector2d& dims,
              const rtypes::discretize_ratio& resolution)
-      : stacked_grid2D(dims, resolution) {
+      : stacked_grid2D(dims, resolution),
+        m_xtiles((xdsize() + kLockTileDim - 1) / kLockTileDim),
+        m_ytiles((ydsize() + kLockTileDim - 1) / kLockTileDim),
+        m_tile_mtxs(m_xtiles * m_ytiles) {
     for (size_t i = 0; i < xdsize(); ++i) {
       for (size_t j = 0; j < ydsize(); ++j) {
         access<kCell>(i, j).loc(rmath::vector2z(i, j));
@@ -89,11 +102,62 @@ class arena_grid : public rds::stacked_grid2D<arena_layer_stack> {
     }   /* for(i..) */
   }     /* reset */
 
-  std::mutex* mtx(void) { return &m_mtx; }
+  /**
+   * \brief The mutex protecting the grid as a whole. Operations which can touch
+   * any cell (e.g. block distribution) should hold it exclusively; operations
+   * which only touch a small region should use \ref region_lock() instead.
+   */
+  std::shared_mutex* mtx(void) { return &m_mtx; }
+
+  /**
+   * \brief Lock the region of the grid bounded by the specified (inclusive)
+   * lower left and upper right cells.
+   *
+   * The grid mutex is acquired in shared mode, and then the mutex for each tile
+   * overlapping the region, in increasing order of tile index, so that
+   * concurrent region locks cannot deadlock. Regions in different tiles can be
+   * locked simultaneously; locking the grid exclusively via \ref mtx() excludes
+   * all regions.
+   */
+  void region_lock(const rmath::vector2z& ll, const rmath::vector2z& ur) const {
+    m_mtx.lock_shared();
+    auto tiles = region_tiles(ll, ur);
+    for (size_t i = tiles.first.x(); i <= tiles.second.x(); ++i) {
+      for (size_t j = tiles.first.y(); j <= tiles.second.y(); ++j) {
+        m_tile_mtxs[i * m_ytiles + j].lock();
+      } /* for(j..) */
+    } /* for(i..) */
+  }
+
+  /**
+   * \brief Unlock a region of the grid previously locked via \ref
+   * region_lock().
+   */
+  void region_unlock(const rmath::vector2z& ll, const rmath::vector2z& ur) const {
+    auto tiles = region_tiles(ll, ur);
+    for (size_t i = tiles.first.x(); i <= tiles.second.x(); ++i) {
+      for (size_t j = tiles.first.y(); j <= tiles.second.y(); ++j) {
+        m_tile_mtxs[i * m_ytiles + j].unlock();
+      } /* for(j..) */
+    } /* for(i..) */
+    m_mtx.unlock_shared();
+  }
 
  private:
+  std::pair<rmath::vector2z, rmath::vector2z> region_tiles(
+      const rmath::vector2z& ll,
+      const rmath::vector2z& ur) const {
+    return {rmath::vector2z(std::min(ll.x() / kLockTileDim, m_xtiles - 1),
+                            std::min(ll.y() / kLockTileDim, m_ytiles - 1)),
+            rmath::vector2z(std::min(ur.x() / kLockTileDim, m_xtiles - 1),
+                            std::min(ur.y() / kLockTileDim, m_ytiles - 1))};
+  }
+
   /* clang-format off */
-  std::mutex m_mtx{};
+  mutable std::shared_mutex       m_mtx{};
+  size_t                          m_xtiles;
+  size_t                          m_ytiles;
+  mutable std::vector<std::mutex> m_tile_mtxs;
   /* clang-format on */
 };
 
@@ -0,0 +1,127 @@
+/**
+ * \file block2D_fifo.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_DS_BLOCK2D_FIFO_HPP_
+#define INCLUDE_COSM_DS_BLOCK2D_FIFO_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/ds/block2D_vector.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class block2D_fifo
+ * \ingroup ds
+ *
+ * \brief A FIFO queue of blocks which are NOT owned by this class, ordered by
+ * when they were added, with O(1) push/pop and O(1) membership checks by block
+ * ID. Each block can only be present once.
+ *
+ * Copies share storage until one of them is modified (copy on write), so
+ * copying is O(1). Whether the storage is shared is decided from its reference
+ * count without synchronization, so the queue is NOT thread safe, even across
+ * copies: a queue and all copies sharing its storage must only be copied or
+ * modified by one thread at a time (e.g., under the same lock).
+ *
+ * Has a \ref to_str() method for more convenient debugging.
+ */
+class block2D_fifo {
+ public:
+  using value_type = block2D_vectorno_type;
+  using const_iterator = std::deque<value_type>::const_iterator;
+
+  block2D_fifo(void) : m_storage(std::make_shared<storage>()) {}
+  explicit block2D_fifo(const block2D_vectorno& blocks);
+
+  size_t size(void) const { return m_storage->blocks.size(); }
+  bool empty(void) const { return m_storage->blocks.empty(); }
+  const_iterator begin(void) const { return m_storage->blocks.begin(); }
+  const_iterator end(void) const { return m_storage->blocks.end(); }
+
+  /**
+   * \brief Get the oldest block in the queue.
+   */
+  value_type front(void) const { return m_storage->blocks.front(); }
+
+  /**
+   * \brief \c TRUE iff the block with the specified ID is in the queue.
+   */
+  bool contains(const rtypes::type_uuid& id) const {
+    return m_storage->ids.end() != m_storage->ids.find(id.v());
+  }
+
+  /**
+   * \brief Add a block to the back of the queue.
+   *
+   * \return \c TRUE iff the block was added, and \c FALSE if a block with the
+   * same ID is already present.
+   */
+  bool push_back(value_type block);
+
+  /**
+   * \brief Remove the block with the same ID as the specified block from the
+   * queue. O(1) if it is the oldest block, and O(n) otherwise.
+   *
+   * \return \c TRUE iff a block was removed.
+   */
+  bool remove(const crepr::base_block2D* block);
+
+  /**
+   * \brief Get a string representation of the queue contents.
+   */
+  std::string to_str(void) const;
+
+ private:
+  struct storage {
+    std::deque<value_type>  blocks{};
+    std::unordered_set<int> ids{};
+  };
+
+  /**
+   * \brief Get the storage for modification, first making a private copy of
+   * it if it is shared with another queue. Racy if another queue sharing the
+   * storage is copied or modified concurrently.
+   */
+  storage& storage_mut(void);
+
+  /* clang-format off */
+  std::shared_ptr<storage> m_storage;
+  /* clang-format on */
+};
+
+NS_END(ds, cosm);
+
+#endif /* INCLUDE_COSM_DS_BLOCK2D_FIFO_HPP_ */
@@ -0,0 +1,128 @@
+/**
+ * \file swap_remove_map.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_DS_SWAP_REMOVE_MAP_HPP_
+#define INCLUDE_COSM_DS_SWAP_REMOVE_MAP_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class swap_remove_map
+ * \ingroup ds
+ *
+ * \brief A map of UUID -> value which is also indexable by position in
+ * [0, size()), for O(1) uniform random selection. Removal swaps the removed
+ * element with the last one, so positions of elements are NOT stable across
+ * removals.
+ */
+template<typename T>
+class swap_remove_map {
+ public:
+  using value_type = std::pair<rtypes::type_uuid, T>;
+
+  swap_remove_map(void) = default;
+
+  size_t size(void) const { return m_values.size(); }
+  bool empty(void) const { return m_values.empty(); }
+  bool contains(const rtypes::type_uuid& id) const {
+    return m_index.end() != m_index.find(id.v());
+  }
+
+  /**
+   * \brief Get the value of the element with the specified ID.
+   *
+   * \return The value, or NULL if no element has the specified ID.
+   */
+  const T* find(const rtypes::type_uuid& id) const {
+    auto it = m_index.find(id.v());
+    return (m_index.end() == it) ? nullptr : &m_values[it->second].second;
+  }
+
+  /**
+   * \brief Get the element at the specified position.
+   */
+  const value_type& operator[](size_t i) const { return m_values[i]; }
+
+  /**
+   * \brief Add an element with the specified ID.
+   *
+   * \return \c TRUE if the element was added, and \c FALSE if an element with
+   * the specified ID is already present.
+   */
+  bool insert(const rtypes::type_uuid& id, const T& value) {
+    if (!m_index.emplace(id.v(), m_values.size()).second) {
+      return false;
+    }
+    m_values.emplace_back(id, value);
+    return true;
+  }
+
+  /**
+   * \brief Remove the element with the specified ID, if it is present.
+   *
+   * \return \c TRUE if an element was removed, and \c FALSE otherwise.
+   */
+  bool remove(const rtypes::type_uuid& id) {
+    auto it = m_index.find(id.v());
+    if (m_index.end() == it) {
+      return false;
+    }
+    size_t pos = it->second;
+    m_index.erase(it);
+    if (pos != m_values.size() - 1) {
+      m_values[pos] = std::move(m_values.back());
+      m_index[m_values[pos].first.v()] = pos;
+    }
+    m_values.pop_back();
+    return true;
+  }
+
+  void clear(void) {
+    m_values.clear();
+    m_index.clear();
+  }
+
+ private:
+  /* clang-format off */
+  std::vector<value_type>         m_values{};
+  std::unordered_map<int, size_t> m_index{};
+  /* clang-format on */
+};
+
+NS_END(ds, cosm);
+
+#endif /* INCLUDE_COSM_DS_SWAP_REMOVE_MAP_HPP_ */
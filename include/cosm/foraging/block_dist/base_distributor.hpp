@@ -33,6 +33,8 @@
 #include "cosm/ds/entity_vector.hpp"
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
 #include "rcppsw/math/rng.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -74,8 +76,10 @@ class base_distributor {
    *
    * \param block The block to distribute.
    * \param entities The list of entities that the block should be distributed
-   *                 around. If block distribution is successful, then the
-   *                 distributed block is added to the entity list.
+   *                 around, in addition to the blocks/caches present in the
+   *                 arena grid, which are always avoided. If block
+   *                 distribution is successful, then the distributed block is
+   *                 added to the entity list.
    *
    * \return \c TRUE if the block distribution was successful, \c FALSE
    * otherwise.
@@ -89,6 +93,25 @@ class base_distributor {
    */
   virtual cfds::block_cluster_vector<TBlockType> block_clusters(void) const = 0;
 
+  /**
+   * \brief Update the \ref block_clusters (if any) after a block has been
+   * dropped in the arena outside of block distribution.
+   */
+  virtual void clusters_update_after_drop(const TBlockType*) {}
+
+  /**
+   * \brief Update the \ref block_clusters (if any) after the block with the
+   * specified ID has been picked up from the specified cell.
+   */
+  virtual void clusters_update_after_pickup(const rtypes::type_uuid&,
+                                            const rmath::vector2z&) {}
+
+  /**
+   * \brief Rebuild the \ref block_clusters (if any) from the arena grid, after
+   * it has been reset.
+   */
+  virtual void clusters_recalc(void) {}
+
   /**
    * \brief Calls \ref distribute_block on each block.
    *
@@ -52,7 +52,9 @@ class cluster_distributor final : public rer::client<cluster_distributor<TBlockT
  public:
   using block_vectorno_type = typename base_distributor<TBlockType>::block_vectorno_type;
   cluster_distributor(const cds::arena_grid::view& view,
+                      const cds::arena_grid* arena_grid,
                       const rtypes::discretize_ratio& resolution,
+                      const rmath::vector2d& max_block_dims,
                       uint capacity,
                       rmath::rng* rng);
   ~cluster_distributor(void) override = default;
@@ -65,6 +67,14 @@ class cluster_distributor final : public rer::client<cluster_distributor<TBlockT
   bool distribute_blocks(block_vectorno_type& blocks,
                          cds::const_entity_vector& entities) override;
   cfds::block_cluster_vector<TBlockType> block_clusters(void) const override;
+  void clusters_update_after_drop(const TBlockType* block) override {
+    m_clust.update_after_drop(block);
+  }
+  void clusters_update_after_pickup(const rtypes::type_uuid& id,
+                                    const rmath::vector2z& coord) override {
+    m_clust.update_after_pickup(id, coord);
+  }
+  void clusters_recalc(void) override { m_clust.blocks_recalc(); }
 
  private:
   /* clang-format off */
@@ -38,6 +38,7 @@
 #include "rcppsw/types/discretize_ratio.hpp"
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/rng.hpp"
+#include "rcppsw/math/vector2.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -94,16 +95,21 @@ class dispatcher {
    * function, rather than happening in the constructor, so that error handling
    * can be done without exceptions.
    *
+   * \param rng The random number generator to use.
+   * \param max_block_dims The largest X/Y dimensions of any block in the
+   *                       arena.
+   *
    * \return \c TRUE if initialization successful, \c FALSE otherwise.
    */
-  bool initialize(rmath::rng* rng);
+  bool initialize(rmath::rng* rng, const rmath::vector2d& max_block_dims);
 
   /**
    * \brief Distribute a block in the arena.
    *
    * \param block The block to distribute.
    * \param entities List of all arena entities in the arena that distribution
-   * should treat as obstacles/things that blocks should not be placed in.
+   * should treat as obstacles/things that blocks should not be placed in, in
+   * addition to the blocks/caches present in the arena grid.
    *
    * \return \c TRUE iff distribution was successful, \c FALSE otherwise.
    */
@@ -120,6 +126,7 @@ class dispatcher {
   const base_distributor<TBlockType>* distributor(void) const {
     return m_dist.get();
   }
+  base_distributor<TBlockType>* distributor(void) { return m_dist.get(); }
 
   const rmath::ranged& distributable_areax(void) const { return mc_arena_xrange; }
   const rmath::ranged& distributable_areay(void) const { return mc_arena_yrange; }
@@ -55,7 +55,9 @@ class multi_cluster_distributor final : public rer::client<multi_cluster_distrib
   using base_distributor<TBlockType>::rng;
 
   multi_cluster_distributor(std::vector<cds::arena_grid::view>& grids,
+                            const cds::arena_grid* arena_grid,
                             rtypes::discretize_ratio resolution,
+                            const rmath::vector2d& max_block_dims,
                             uint maxsize,
                             rmath::rng* rng_in);
 
@@ -66,6 +68,10 @@ class multi_cluster_distributor final : public rer::client<multi_cluster_distrib
   cfds::block_cluster_vector<TBlockType> block_clusters(void) const override;
   bool distribute_block(TBlockType* block,
                         cds::const_entity_vector& entities) override;
+  void clusters_update_after_drop(const TBlockType* block) override;
+  void clusters_update_after_pickup(const rtypes::type_uuid& id,
+                                    const rmath::vector2z& coord) override;
+  void clusters_recalc(void) override;
 
  private:
   /* clang-format off */
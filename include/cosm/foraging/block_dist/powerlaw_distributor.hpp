@@ -66,6 +66,7 @@ class powerlaw_distributor final : public rer::client<powerlaw_distributor<TBloc
 
   powerlaw_distributor(const config::powerlaw_dist_config* config,
                        const rtypes::discretize_ratio& resolution,
+                       const rmath::vector2d& max_block_dims,
                        rmath::rng* rng_in);
 
   /* not copy constructible or copy assignable by default */
@@ -75,6 +76,10 @@ class powerlaw_distributor final : public rer::client<powerlaw_distributor<TBloc
   cfds::block_cluster_vector<TBlockType> block_clusters(void) const override;
   bool distribute_block(TBlockType* block,
                         cds::const_entity_vector& entities) override;
+  void clusters_update_after_drop(const TBlockType* block) override;
+  void clusters_update_after_pickup(const rtypes::type_uuid& id,
+                                    const rmath::vector2z& coord) override;
+  void clusters_recalc(void) override;
 
   /**
    * \brief Computer cluster locations such that no two clusters overlap, and
@@ -93,34 +98,84 @@ class powerlaw_distributor final : public rer::client<powerlaw_distributor<TBloc
     uint                  capacity;
   };
 
+  /**
+   * \brief The bounds of a (potential) cluster within the arena. Bounds are
+   * treated as closed when checking for overlap, so that placed clusters are
+   * never directly adjacent.
+   */
+  struct cluster_placement {
+    rmath::vector2z ll;
+    rmath::vector2z ur;
+    uint            capacity;
+  };
+
   using cluster_paramvec = std::vector<cluster_config>;
+  using placement_vector = std::vector<cluster_placement>;
   using dist_map_value_type = std::list<cluster_distributor<TBlockType>>;
 
   /**
-   * \brief Assign cluster centers randomly, with the only restriction that the
-   * edges of each cluster are within the boundaries of the arena.
+   * \brief Assign a cluster of the specified size a random location, with the
+   * only restriction that the edges of the cluster are within the boundaries of
+   * the arena. If the cluster is too large to fit in the arena, the placement
+   * will extend past it (see \ref placement_in_grid()).
+   */
+  static cluster_placement guess_cluster_placement(const cds::arena_grid* grid,
+                                                   uint clust_size,
+                                                   rmath::rng* rng);
+
+  /**
+   * \brief \c TRUE iff the (closed) bounds of the placement are within the
+   * arena grid.
+   */
+  static bool placement_in_grid(const cds::arena_grid* grid,
+                                const cluster_placement& p);
+
+  /**
+   * \brief Assign cluster centers randomly via \ref guess_cluster_placement().
    *
    * \param grid Arena grid.
    * \param clust_sizes Vector of powers of 2 for the cluster sizes.
+   * \param rng The RNG to draw locations from.
    */
-  cluster_paramvec guess_cluster_placements(
-      cds::arena_grid* grid,
-      const std::vector<uint>& clust_sizes);
+  static placement_vector guess_cluster_placements(
+      const cds::arena_grid* grid,
+      const std::vector<uint>& clust_sizes,
+      rmath::rng* rng);
 
   /**
    * \brief Verify that no cluster placements cause overlap, after guessing
    * initial locations.
    *
-   * \param list Possible list of cluster placements.
+   * Sweeps across the arena in X, tracking the Y extents of the clusters which
+   * overlap the sweep line, so checking is O(k log k) rather than O(k^2) in the
+   * # of clusters.
+   *
+   * \param pvec Possible list of cluster placements.
    *
    * \return \c TRUE if the cluster distribute is valid, \c FALSE otherwise.
    */
-  bool check_cluster_placements(const cluster_paramvec& pvec) RCSW_PURE;
+  static bool check_cluster_placements(const placement_vector& pvec);
+
+  /**
+   * \brief Greedily place clusters, largest first, each at the first randomly
+   * chosen location which does not overlap any cluster already placed. Used if
+   * guess and check placement fails.
+   *
+   * \return The placements, or an empty vector if not all clusters could be
+   * placed.
+   */
+  placement_vector pack_cluster_placements(const cds::arena_grid* grid,
+                                           const std::vector<uint>& clust_sizes);
 
   /**
    * \brief Perform a "guess and check" cluster placement until you get a
    * distribution without overlap, or \ref kMAX_DIST_TRIES is exceeded,
-   * whichever happens first.
+   * whichever happens first. If no guess is valid, fall back to \ref
+   * pack_cluster_placements().
+   *
+   * Guesses are evaluated in parallel, each with its own RNG seeded from the
+   * distributor's RNG, and the first valid guess (in order) is used, so the
+   * result does not depend on the # of threads.
    *
    * Cluster sizes are drawn from the internally stored power law distribution.
    */
@@ -129,6 +184,7 @@ class powerlaw_distributor final : public rer::client<powerlaw_distributor<TBloc
 
   /* clang-format off */
   const rtypes::discretize_ratio             mc_resolution;
+  const rmath::vector2d                      mc_max_block_dims;
 
   uint                                       m_n_clusters{0};
   std::map<uint, dist_map_value_type>        m_dist_map{};
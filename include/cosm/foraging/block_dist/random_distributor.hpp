@@ -57,6 +57,15 @@ NS_START(foraging, block_dist);
  * \brief Distributes a set of blocks randomly within a specified 2D area, such
  * that no blocks overlap with each other or other entities already present in
  * the arena (nest, cache, etc.).
+ *
+ * Placements are drawn directly from a list of free cells within the area,
+ * rather than by rejection sampling against all entities. The free list is
+ * built from an occupancy bitmap of the area computed from the entities to
+ * avoid, and candidates drawn from it are only checked against the blocks and
+ * caches in the arena grid cells near them, so the cost of a placement does
+ * not depend on the # of entities in the arena. Cells which become free after
+ * the list was built are only considered again once it is rebuilt, which
+ * happens when it is exhausted.
  */
 template<typename TBlockType>
 class random_distributor : public rer::client<random_distributor<TBlockType>>,
@@ -66,8 +75,19 @@ class random_distributor : public rer::client<random_distributor<TBlockType>>,
   using base_distributor<TBlockType>::rng;
   using base_distributor<TBlockType>::kMAX_DIST_TRIES;
 
+  /**
+   * \param grid The area to distribute blocks within.
+   * \param arena_grid The grid for the ENTIRE arena, for checking for conflicts
+   *                   with entities near (but possibly outside of) the area.
+   * \param resolution The arena resolution.
+   * \param max_block_dims The largest X/Y dimensions of any block in the
+   *                       arena, for bounding the area searched for conflicts.
+   * \param rng_in The random number generator to use.
+   */
   random_distributor(const cds::arena_grid::view& grid,
+                     const cds::arena_grid* arena_grid,
                      const rtypes::discretize_ratio& resolution,
+                     const rmath::vector2d& max_block_dims,
                      rmath::rng* rng_in);
 
   random_distributor& operator=(const random_distributor&) = delete;
@@ -109,16 +129,36 @@ class random_distributor : public rer::client<random_distributor<TBlockType>>,
       const cds::const_entity_vector& entities,
       const rmath::vector2d& block_dim);
 
+  /**
+   * \brief Rebuild the occupancy bitmap for the distribution area from the
+   * specified entities, and the list of free cells from the bitmap.
+   *
+   * A cell is occupied if placing a block at it would cause the block to
+   * overlap any of the entities.
+   */
+  void free_cells_rebuild(const cds::const_entity_vector& entities,
+                          const rmath::vector2d& block_dim);
+
+  /**
+   * \brief Determine if placing a block of the specified dimensions at the
+   * specified absolute coordinates would cause it to overlap any block or cache
+   * in the arena. Only the grid cells near the placement are checked.
+   *
+   * \param ignore An entity to ignore when checking for overlap (may be NULL).
+   */
+  bool local_conflict(const rmath::vector2z& abs,
+                      const rmath::vector2d& block_dim,
+                      const crepr::entity_base* ignore) const;
+
   /**
    * \brief Once a block has been distributed, perform distribution sanity
    * checks.
    *
    * - Blocks should not be out of sight.
    * - The cell it was distributed into should refer to it.
-   * - No entity should overlap with the block after distribution.
+   * - No block or cache should overlap with the block after distribution.
    */
   bool verify_block_dist(const TBlockType* block,
-                         const cds::const_entity_vector& entities,
                          const cds::cell2D* cell) RCSW_PURE;
 
   /* clang-format off */
@@ -126,7 +166,12 @@ class random_distributor : public rer::client<random_distributor<TBlockType>>,
   const rmath::vector2z          mc_origin;
   const rmath::rangeu            mc_xspan;
   const rmath::rangeu            mc_yspan;
+  const cds::arena_grid*         mc_arena_grid;
   cds::arena_grid::view          m_grid;
+  std::vector<bool>              m_occupied{};
+  std::vector<rmath::vector2z>   m_free{};
+  rmath::vector2d                m_occupied_dims{};
+  rmath::vector2d                m_max_block_dims{};
   /* clang-format on */
 };
 
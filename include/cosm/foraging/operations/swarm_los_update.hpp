@@ -0,0 +1,138 @@
+/**
+ * \file swarm_los_update.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_FORAGING_OPERATIONS_SWARM_LOS_UPDATE_HPP_
+#define INCLUDE_COSM_FORAGING_OPERATIONS_SWARM_LOS_UPDATE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/foraging/operations/robot_los_update.hpp"
+#include "cosm/pal/argos_sm_adaptor.hpp"
+#include "cosm/pal/argos_swarm_iterator.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, foraging, operations);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class swarm_los_update
+ * \ingroup foraging operations
+ *
+ * \brief Update the LOS of all robots in the swarm in a single parallel pass,
+ * as an alternative to applying \ref robot_los_update to each robot.
+ *
+ * Robots are grouped by the arena grid tile they are in, so that robots with
+ * overlapping LOS are (mostly) processed by the same thread, one after the
+ * other. Per-robot state is kept between timesteps, so after the first
+ * timestep updating does not allocate, and if the controllers support it LOS
+ * objects are reset in place rather than re-allocated (see \ref
+ * utils::set_robot_los()).
+ *
+ * The arena must not be modified during the update, so it should be run
+ * before robots are processed each timestep (e.g., in loop functions \c
+ * pre_step()).
+ *
+ * \tparam TRobotType The type of the robot within the ::argos namespace of
+ *                    the robots in the swarm.
+ * \tparam TControllerType The type of the controller.
+ * \tparam TArenaMapType The type of the arena map.
+ */
+template <typename TRobotType, typename TControllerType, typename TArenaMapType>
+class swarm_los_update final
+    : public rer::client<
+          swarm_los_update<TRobotType, TControllerType, TArenaMapType>> {
+ public:
+  swarm_los_update(TArenaMapType* const map,
+                   std::string robot_type,
+                   uint n_threads)
+      : ER_CLIENT_INIT("cosm.foraging.operations.swarm_los_update"),
+        mc_robot_type(std::move(robot_type)),
+        mc_n_threads(std::max(1U, n_threads)),
+        m_map(map),
+        m_robot_update(map) {}
+
+  swarm_los_update(const swarm_los_update&) = delete;
+  swarm_los_update& operator=(const swarm_los_update&) = delete;
+
+  void operator()(const cpal::argos_sm_adaptor* const sm) {
+    size_t n_robots = sm->swarm_entities<TRobotType>(mc_robot_type).size();
+    m_controllers.resize(n_robots);
+    m_tiles.resize(n_robots);
+    m_order.resize(n_robots);
+
+    /* gather controllers and the tile each robot is in */
+    size_t ytiles = m_map->ydsize() / kTileDim + 1;
+    auto gather = [&](TControllerType* c, size_t i) {
+      auto pos = rmath::dvec2zvec(c->pos2D(), m_map->grid_resolution().v());
+      m_controllers[i] = c;
+      m_tiles[i] = (pos.x() / kTileDim) * ytiles + pos.y() / kTileDim;
+    };
+    cpal::argos_swarm_iterator::controllers<TRobotType,
+                                            TControllerType,
+                                            cpal::iteration_order::ekPARALLEL>(
+        sm, gather, mc_robot_type, mc_n_threads);
+
+    std::iota(m_order.begin(), m_order.end(), 0);
+    std::sort(m_order.begin(), m_order.end(), [&](size_t i, size_t j) {
+      return m_tiles[i] < m_tiles[j] || (m_tiles[i] == m_tiles[j] && i < j);
+    });
+
+    /*
+     * Static scheduling gives each thread a contiguous range of robots in tile
+     * order.
+     */
+#pragma omp parallel for schedule(static) num_threads(mc_n_threads)
+    for (size_t i = 0; i < m_order.size(); ++i) {
+      m_robot_update(m_controllers[m_order[i]]);
+    } /* for(i..) */
+  }
+
+ private:
+  static constexpr const size_t kTileDim = cds::arena_grid::kLockTileDim;
+
+  /* clang-format off */
+  const std::string                                mc_robot_type;
+  const uint                                       mc_n_threads;
+
+  TArenaMapType* const                             m_map;
+  robot_los_update<TControllerType, TArenaMapType> m_robot_update;
+  std::vector<TControllerType*>                    m_controllers{};
+  std::vector<size_t>                              m_tiles{};
+  std::vector<size_t>                              m_order{};
+  /* clang-format on */
+};
+
+NS_END(operations, foraging, cosm);
+
+#endif /* INCLUDE_COSM_FORAGING_OPERATIONS_SWARM_LOS_UPDATE_HPP_ */
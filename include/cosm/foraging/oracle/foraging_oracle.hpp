@@ -105,7 +105,7 @@ class foraging_oracle : public coracle::aggregate_oracle<detail::oracle_types> {
   }
 
   const caches_oracle_type* caches(void) const {
-    return oracle_get<caches_oracle_type>(kBlocks);
+    return oracle_get<caches_oracle_type>(kCaches);
   }
 
   const tasking_oracle_type* tasking(void) const {
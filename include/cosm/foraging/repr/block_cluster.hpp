@@ -52,6 +52,11 @@ NS_START(cosm, foraging, repr);
  * - The 2D area in which the blocks reside
  * - The blocks distributed in that area.
  * - The maximum capacity of the cluster.
+ *
+ * The blocks in the cluster are tracked incrementally as blocks are
+ * distributed to/dropped in/picked up from cells within the cluster, rather
+ * than by scanning the cluster's cells, so that block counts are O(1) and
+ * membership updates are O(# blocks in cluster).
  */
 template<typename TBlockType>
 class block_cluster : public crepr::grid_view_entity<cds::arena_grid::const_view>,
@@ -70,12 +75,40 @@ class block_cluster : public crepr::grid_view_entity<cds::arena_grid::const_view
         m_capacity(capacity) {}
 
   uint capacity(void) const { return m_capacity; }
-  size_t block_count(void) const { return blocks().size(); }
-  block_vectorro_type blocks(void) const RCSW_PURE;
+  size_t block_count(void) const { return m_blocks.size(); }
+  const block_vectorro_type& blocks(void) const { return m_blocks; }
+
+  /**
+   * \brief Update the cluster after a block has been placed in the arena: if
+   * it is now on a cell within the cluster it is added to the cluster, if it is
+   * not already present.
+   */
+  void update_after_drop(const TBlockType* block);
+
+  /**
+   * \brief Update the cluster after the block with the specified ID has been
+   * picked up from the specified cell, removing it from the cluster if the
+   * cell is within the cluster.
+   */
+  void update_after_pickup(const rtypes::type_uuid& id,
+                           const rmath::vector2z& coord);
+
+  /**
+   * \brief Rebuild the set of blocks in the cluster from the cells within it,
+   * after the arena grid has been modified wholesale (e.g., reset).
+   */
+  void blocks_recalc(void);
 
  private:
+  bool contains_cell(const rmath::vector2z& coord) const {
+    auto origin = dloc2D();
+    return coord.x() >= origin.x() && coord.x() < origin.x() + xdimd() &&
+           coord.y() >= origin.y() && coord.y() < origin.y() + ydimd();
+  }
+
   /* clang-format off */
-  uint m_capacity;
+  uint                m_capacity;
+  block_vectorro_type m_blocks{};
   /* clang-format on */
 };
 
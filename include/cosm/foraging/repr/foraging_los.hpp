@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <boost/multi_array.hpp>
+#include <boost/optional.hpp>
 #include <list>
 #include <utility>
 
@@ -65,6 +66,9 @@ NS_START(cosm, foraging, repr);
  * The line of sight itself is meant to be a read-only view of part of the
  * arena, but it also exposes non-const access to the blocks and caches within
  * that part of the arena by necessity for event processing.
+ *
+ * Because it is only a view, a LOS can be moved to a different part of the
+ * arena via \ref reset() as its robot moves, rather than allocating a new one.
  */
 class foraging_los final : public rer::client<foraging_los> {
  public:
@@ -73,8 +77,17 @@ class foraging_los final : public rer::client<foraging_los> {
 
   foraging_los(const const_grid_view& c_view, const rmath::vector2z& center)
       : ER_CLIENT_INIT("cosm.foraging.repr.foraging_los"),
-        mc_center(center),
-        mc_view(c_view) {}
+        m_center(center),
+        m_view(c_view) {}
+
+  /**
+   * \brief Move the LOS to view a different part of the arena, centered at the
+   * specified location.
+   */
+  void reset(const const_grid_view& c_view, const rmath::vector2z& center) {
+    m_center = center;
+    m_view.emplace(c_view);
+  }
 
   /**
    * \brief Get the list of blocks currently in the LOS.
@@ -94,7 +107,7 @@ class foraging_los final : public rer::client<foraging_los> {
    *
    * \return The X dimension.
    */
-  size_t xsize(void) const { return mc_view.shape()[0]; }
+  size_t xsize(void) const { return m_view->shape()[0]; }
 
   rmath::vector2z abs_ll(void) const RCSW_PURE;
   rmath::vector2z abs_lr(void) const RCSW_PURE;
@@ -106,10 +119,11 @@ class foraging_los final : public rer::client<foraging_los> {
    *
    * \return The Y dimension.
    */
-  grid_view::size_type ysize(void) const { return mc_view.shape()[1]; }
+  grid_view::size_type ysize(void) const { return m_view->shape()[1]; }
 
   /**
    * \brief Determine if the *ABSOLUTE* arena location is contained in the LOS.
+   * O(1), because the LOS is always rectangular.
    */
   bool contains_loc(const rmath::vector2z& loc) const RCSW_PURE;
 
@@ -118,7 +132,7 @@ class foraging_los final : public rer::client<foraging_los> {
    *
    * \return # elements.
    */
-  grid_view::size_type size(void) const { return mc_view.num_elements(); }
+  grid_view::size_type size(void) const { return m_view->num_elements(); }
 
   /**
    * \brief Get the cell associated with a particular grid location within the
@@ -137,12 +151,27 @@ class foraging_los final : public rer::client<foraging_los> {
    *
    * \return The center coordinates (discrete version).
    */
-  const rmath::vector2z& center(void) const { return mc_center; }
+  const rmath::vector2z& center(void) const { return m_center; }
 
  private:
+  /**
+   * \brief Visit each cell in the LOS, in the same order as iterating over the
+   * relative X, and then Y, coordinates via \ref cell().
+   *
+   * Walks the underlying grid directly, rather than through nested views,
+   * which is much faster for the per-timestep scans of the LOS.
+   */
+  template<typename TFunc>
+  void cells_visit(const TFunc& f) const;
+
   /* clang-format off */
-  const rmath::vector2z mc_center;
-  const const_grid_view mc_view;
+  rmath::vector2z                  m_center;
+
+  /*
+   * Views cannot be re-assigned to view something else, so we have to
+   * re-construct in place on \ref reset().
+   */
+  boost::optional<const_grid_view> m_view;
   /* clang-format on */
 };
 
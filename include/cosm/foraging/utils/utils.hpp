@@ -29,6 +29,8 @@
  * Includes
  ******************************************************************************/
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/math/vector3.hpp"
@@ -38,6 +40,7 @@
  * Namespaces
  ******************************************************************************/
 namespace cosm::repr {
+class entity_base;
 class entity2D;
 class entity3D;
 } /* namespace cosm::repr */
@@ -61,6 +64,22 @@ struct placement_status_t {
   bool y_conflict{false};
 };
 
+namespace detail {
+/**
+ * \brief Detect if a controller provides non-const access to its current LOS
+ * via \c los(), so that the LOS can be reset in place rather than replaced.
+ */
+template <typename TControllerType, typename = void>
+struct has_mutable_los : std::false_type {};
+
+template <typename TControllerType>
+struct has_mutable_los<
+    TControllerType,
+    std::void_t<decltype(std::declval<TControllerType&>().los())>>
+    : std::is_convertible<decltype(std::declval<TControllerType&>().los()),
+                          cfrepr::foraging_los*> {};
+} /* namespace detail */
+
 /*******************************************************************************
  * Functions
  ******************************************************************************/
@@ -83,6 +102,15 @@ placement_status_t placement_conflict2D(const rmath::vector2d& ent1_loc,
                                         const rmath::vector2d& ent1_dims,
                                         const crepr::entity3D* entity);
 
+/**
+ * \brief Determine entity overlap with \p entity when its dimensionality is
+ * not known at compile time, dispatching to the 2D or 3D version as
+ * appropriate.
+ */
+placement_status_t placement_conflict2D(const rmath::vector2d& ent1_loc,
+                                        const rmath::vector2d& ent1_dims,
+                                        const crepr::entity_base* entity);
+
 /**
  * \brief Compute the line of sight for a given robot.
  *
@@ -101,15 +129,32 @@ std::unique_ptr<cfrepr::foraging_los> compute_robot_los(
 /**
  * \brief Set the LOS of a robot in the arena.
  *
+ * If the controller provides non-const access to its LOS and already has one,
+ * it is reset in place to avoid allocating a new LOS every timestep.
+ *
  * This is a hack that makes getting my research up and running easier.
  *
  * \todo This should eventually be replaced by a calculation of a robot's LOS by
  * the robot, probably using on-board cameras.
+ *
+ * \tparam TArenaMapType The type of the arena map (e.g., \ref
+ *                       carena::base_arena_map). Must provide \c
+ *                       grid_resolution() and a const \c subgrid().
  */
-template <typename TControllerType, typename TBlockType>
+template <typename TControllerType, typename TArenaMapType>
 void set_robot_los(TControllerType* const controller,
                    uint los_grid_size,
-                   carena::base_arena_map<TBlockType>& map) {
+                   TArenaMapType& map) {
+  if constexpr (detail::has_mutable_los<TControllerType>::value) {
+    auto* los = controller->los();
+    if (nullptr != los) {
+      rmath::vector2z position = rmath::dvec2zvec(controller->pos2D(),
+                                                  map.grid_resolution().v());
+      los->reset(std::as_const(map).subgrid(position, los_grid_size),
+                 position);
+      return;
+    }
+  }
   controller->los(std::move(compute_robot_los(map,
                                               los_grid_size,
                                               controller->pos2D())));
@@ -26,10 +26,12 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
+#include <vector>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/binary_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +51,8 @@ NS_START(cosm, fsm, metrics);
  * gathered stats are supported. Metrics are written out after the specified
  * interval.
  */
-class collision_metrics_collector final : public rmetrics::base_metrics_collector {
+class collision_metrics_collector final : public rmetrics::base_metrics_collector,
+                                          public cmetrics::binary_collector {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -64,19 +67,21 @@ class collision_metrics_collector final : public rmetrics::base_metrics_collecto
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts. Ideally the durations
-   * would be atomic \ref rtypes::timestep, but that type does not meet the
-   * std::atomic requirements.
+   * \brief Container for holding collected statistics. Must be sharded so counts
+   * are valid (and uncontended) in parallel metric collection
+   * contexts. Ideally the durations would be \ref rtypes::timestep, but that
+   * type is not arithmetic.
    */
   struct stats {
-    std::atomic_uint n_in_avoidance{0};
-    std::atomic_uint n_entered_avoidance{0};
-    std::atomic_uint n_exited_avoidance{0};
-    std::atomic_uint avoidance_duration{0};
+    cmetrics::sharded_accumulator<uint> n_in_avoidance{};
+    cmetrics::sharded_accumulator<uint> n_entered_avoidance{};
+    cmetrics::sharded_accumulator<uint> n_exited_avoidance{};
+    cmetrics::sharded_accumulator<uint> avoidance_duration{};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
+  std::vector<std::string> binary_cols(void) const override;
+  std::list<std::string> data_cols(void) const;
   boost::optional<std::string> csv_line_build(void) override;
 
   /* clang-format off */
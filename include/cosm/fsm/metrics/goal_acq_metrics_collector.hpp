@@ -26,10 +26,12 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
+#include <vector>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/binary_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -49,7 +51,8 @@ NS_START(cosm, fsm, metrics);
  * gathered stats are supported. Metrics are written out at the end of the
  * specified interval.
  */
-class goal_acq_metrics_collector final : public rmetrics::base_metrics_collector {
+class goal_acq_metrics_collector final : public rmetrics::base_metrics_collector,
+                                         public cmetrics::binary_collector {
  public:
   /**
    * \param ofname_stem Output file name stem.
@@ -64,17 +67,19 @@ class goal_acq_metrics_collector final : public rmetrics::base_metrics_collector
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts.
+   * \brief Container for holding collected statistics. Must be sharded so counts
+   * are valid (and uncontended) in parallel metric collection contexts.
    */
   struct stats {
-    std::atomic_uint n_true_exploring_for_goal{0};
-    std::atomic_uint n_false_exploring_for_goal{0};
-    std::atomic_uint n_vectoring_to_goal{0};
-    std::atomic_uint n_acquiring_goal{0};
+    cmetrics::sharded_accumulator<uint> n_true_exploring_for_goal{};
+    cmetrics::sharded_accumulator<uint> n_false_exploring_for_goal{};
+    cmetrics::sharded_accumulator<uint> n_vectoring_to_goal{};
+    cmetrics::sharded_accumulator<uint> n_acquiring_goal{};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
+  std::vector<std::string> binary_cols(void) const override;
+  std::list<std::string> data_cols(void) const;
   boost::optional<std::string> csv_line_build(void) override;
 
   /* clang-format off */
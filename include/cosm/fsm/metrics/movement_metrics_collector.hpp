@@ -26,11 +26,13 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
+#include <vector>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "rcppsw/types/spatial_dist.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/binary_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -50,7 +52,8 @@ NS_START(cosm, fsm, metrics);
  * gathered stats are supported. Metrics are written out at the end of the
  * specified interval.
  */
-class movement_metrics_collector final : public rmetrics::base_metrics_collector {
+class movement_metrics_collector final : public rmetrics::base_metrics_collector,
+                                         public cmetrics::binary_collector {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -65,18 +68,20 @@ class movement_metrics_collector final : public rmetrics::base_metrics_collector
 
  private:
   /**
-   * \brief Container for holding collected statistics. Must be atomic so counts
-   * are valid in parallel metric collection contexts. Ideally the distances
-   * would be atomic \ref rtypes::spatial_dist, but that type does not meet the
-   * std::atomic requirements.
+   * \brief Container for holding collected statistics. Must be sharded so
+   * counts are valid (and uncontended) in parallel metric collection
+   * contexts. Ideally the distances would be \ref rtypes::spatial_dist, but
+   * that type is not arithmetic.
    */
   struct stats {
-    std::atomic<double> distance{0.0};
-    std::atomic_uint    robot_count{0};
-    std::atomic<double> velocity{0.0};
+    cmetrics::sharded_accumulator<double> distance{};
+    cmetrics::sharded_accumulator<uint>   robot_count{};
+    cmetrics::sharded_accumulator<double> velocity{};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
+  std::vector<std::string> binary_cols(void) const override;
+  std::list<std::string> data_cols(void) const;
   boost::optional<std::string>csv_line_build(void) override;
 
   /* clang-format off */
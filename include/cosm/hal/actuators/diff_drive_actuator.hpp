@@ -30,6 +30,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_differential_steering_actuator.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no differential drive actuator!"
 #endif /* HAL_TARGET */
@@ -42,9 +44,15 @@ NS_START(cosm, hal, actuators, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_ds_actuator = std::is_same<TSensor,
                                           argos::CCI_DifferentialSteeringActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_ds_actuator = std::is_same<TSensor,
+                                               native_sim::diff_drive_actuator>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -60,6 +68,7 @@ NS_END(detail);
  * Supports the following robots:
  *
  * - ARGoS footbot
+ * - native-sim robot
  *
 * \tparam TActuator The underlying actuator handle type abstracted away by the
  * HAL. If nullptr, then that effectively disables the actuator at compile time,
@@ -77,6 +86,7 @@ class diff_drive_actuator_impl {
    */
   explicit diff_drive_actuator_impl(TActuator* const wheels) : m_wheels(wheels) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Set the wheel speeds for the current timestep for a footbot
    * robot. Bounds checking is not performed.
@@ -87,13 +97,23 @@ class diff_drive_actuator_impl {
     RCSW_FPC_RET_V(nullptr != m_wheels);
     m_wheels->SetLinearVelocity(left, right);
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Set the wheel speeds for the current timestep for a native-sim
+   * robot. Bounds checking is not performed.
+   */
+  template <typename U = TActuator,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_ds_actuator<U>::value)>
+  void set_wheel_speeds(double left, double right) {
+    RCSW_FPC_RET_V(nullptr != m_wheels);
+    m_wheels->set_linear_velocity(left, right);
+  }
+#endif /* HAL_TARGET */
 
   /**
    * \brief Stop the wheels of a footbot robot. As far as I know, this is an
    * immediate stop (i.e. no rampdown).
    */
-  template <typename U = TActuator,
-            RCPPSW_SFINAE_FUNC(detail::is_argos_ds_actuator<U>::value)>
   void reset(void) { set_wheel_speeds(0.0, 0.0); }
 
  private:
@@ -104,6 +124,8 @@ class diff_drive_actuator_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using diff_drive_actuator = diff_drive_actuator_impl<argos::CCI_DifferentialSteeringActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using diff_drive_actuator = diff_drive_actuator_impl<native_sim::diff_drive_actuator>;
 #endif /* HAL_TARGET */
 
 NS_END(actuators, hal, cosm);
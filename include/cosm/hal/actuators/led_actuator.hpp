@@ -32,6 +32,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_leds_actuator.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected component has no LEDs!"
 #endif /* HAL_TARGET */
@@ -44,9 +46,15 @@ NS_START(cosm, hal, actuators, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TActuator>
 using is_argos_led_actuator = std::is_same<TActuator,
                                            argos::CCI_LEDsActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TActuator>
+using is_native_sim_led_actuator = std::is_same<TActuator,
+                                                native_sim::led_actuator>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -62,6 +70,8 @@ NS_END(detail);
  *  Supports the following robots:
  *
  * - ARGoS footbot
+ * - native-sim robot. All LEDs are modeled as a single LED, and intensity is
+ *   not modeled.
  *
  * \tparam TActuator The underlying actuator handle type abstracted away by the
  *                   HAL. If nullptr, then that effectively disables the
@@ -78,6 +88,7 @@ class led_actuator_impl {
    */
   void reset(void) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Set a single LED on the footbot robot to a specific color (or set
    * all LEDs to a specific color).
@@ -127,6 +138,18 @@ class led_actuator_impl {
       m_leds->SetSingleIntensity(id, intensity);
     }
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Set the color of the LEDs on the native-sim robot. Since all LEDs
+   * are modeled as one, \p id is ignored.
+   */
+  template <typename U = TActuator,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_led_actuator<U>::value)>
+  void set_color(int, const rutils::color& color) {
+    RCSW_FPC_RET_V(nullptr != m_leds);
+    m_leds->set_color(color);
+  }
+#endif /* HAL_TARGET */
 
  private:
   /* clang-format off */
@@ -136,6 +159,8 @@ class led_actuator_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using led_actuator = led_actuator_impl<argos::CCI_LEDsActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using led_actuator = led_actuator_impl<native_sim::led_actuator>;
 #endif /* HAL_TARGET */
 
 NS_END(actuators, hal, cosm);
@@ -31,6 +31,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_range_and_bearing_actuator.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected component has no RAB actuator!"
 #endif /* HAL_TARGET */
@@ -43,9 +45,15 @@ NS_START(cosm, hal, actuators, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename Actuator>
 using is_argos_rab_actuator = std::is_same<Actuator,
                                            argos::CCI_RangeAndBearingActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename Actuator>
+using is_native_sim_wifi_actuator = std::is_same<Actuator,
+                                                 native_sim::wifi_actuator>;
+#endif /* HAL_TARGET */
 NS_END(detail);
 
 /*******************************************************************************
@@ -62,6 +70,8 @@ NS_END(detail);
  * - ARGoS footbot. These robots will use wifi to broadcast data every timestep
  *   to all robots in range until told to do otherwise.
  *
+ * - native-sim robot. Same semantics as the ARGoS footbot.
+ *
  * \tparam TActuator The underlying actuator handle type abstracted away by the
  *                   HAL. If nullptr, then that effectively disables the
  *                   actuator at compile time, and SFINAE ensures no member
@@ -72,6 +82,7 @@ class wifi_actuator_impl {
  public:
   explicit wifi_actuator_impl(T* const wifi) : m_wifi(wifi) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Start broadcasting the specified data to all footbots within range.
    */
@@ -103,6 +114,37 @@ class wifi_actuator_impl {
       m_wifi->ClearData();
     }
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Start broadcasting the specified data to all robots within range.
+   */
+  template <typename U = T,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_wifi_actuator<U>::value)>
+  void broadcast_start(const struct wifi_packet& packet) {
+    m_wifi->set_data(packet.data);
+  }
+
+  /**
+   * \brief Stop broadcasting the previously specified data to all robots
+   * within range.
+   */
+  template <typename U = T,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_wifi_actuator<U>::value)>
+  void broadcast_stop(void) {
+    m_wifi->clear_data();
+  }
+
+  /**
+   * \brief Reset the wifi device.
+   */
+  template <typename U = T,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_wifi_actuator<U>::value)>
+  void reset(void) {
+    if (nullptr != m_wifi) {
+      m_wifi->clear_data();
+    }
+  }
+#endif /* HAL_TARGET */
 
  private:
   /* clang-format off */
@@ -112,6 +154,8 @@ class wifi_actuator_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using wifi_actuator = wifi_actuator_impl<argos::CCI_RangeAndBearingActuator>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using wifi_actuator = wifi_actuator_impl<native_sim::wifi_actuator>;
 #endif /* HAL_TARGET */
 
 NS_END(actuators, hal, cosm);
@@ -36,4 +36,11 @@
  */
 #define HAL_TARGET_LEGO_EV3 2
 
+/*
+ * \brief The configuration definition to compile for the footbot-like robot
+ * within the built-in kinematic simulator (\ref native_sim::world), which does
+ * not require ARGoS.
+ */
+#define HAL_TARGET_NATIVE_SIM 3
+
 #endif /* INCLUDE_COSM_HAL_HAL_HPP_ */
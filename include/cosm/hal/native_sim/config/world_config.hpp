@@ -0,0 +1,96 @@
+/**
+ * \file world_config.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_HAL_NATIVE_SIM_CONFIG_WORLD_CONFIG_HPP_
+#define INCLUDE_COSM_HAL_NATIVE_SIM_CONFIG_WORLD_CONFIG_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/config/base_config.hpp"
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, hal, native_sim, config);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct world_config
+ * \ingroup hal native_sim config
+ *
+ * \brief Configuration for the \ref native_sim::world. Defaults approximate
+ * the ARGoS footbot. All distances are in meters.
+ */
+struct world_config final : public rconfig::base_config {
+  /**
+   * Length of each simulation step in seconds.
+   */
+  double dt{0.1};
+
+  /**
+   * Radius of the (circular) robot body.
+   */
+  double robot_radius{0.085};
+
+  /**
+   * Distance between the two wheels of the differential drive.
+   */
+  double axle_length{0.14};
+
+  /**
+   * Sensing range of the proximity sensor, measured from the robot body.
+   */
+  double prox_range{0.1};
+
+  /**
+   * Range within which light sources are sensed.
+   */
+  double light_range{3.0};
+
+  /**
+   * Range within which the LEDs of other robots are seen by the camera.
+   */
+  double camera_range{1.0};
+
+  /**
+   * Range within which the wifi data of other robots is received.
+   */
+  double wifi_range{1.0};
+
+  /**
+   * Floor value read by the ground sensor outside of any painted region, in
+   * [0,1] with 0=black and 1=white.
+   */
+  double floor_value{1.0};
+
+  /**
+   * How many threads to use when running robot controllers and integrating
+   * robot motion.
+   */
+  uint n_threads{1};
+};
+
+NS_END(config, native_sim, hal, cosm);
+
+#endif /* INCLUDE_COSM_HAL_NATIVE_SIM_CONFIG_WORLD_CONFIG_HPP_ */
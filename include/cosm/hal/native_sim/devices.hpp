@@ -0,0 +1,326 @@
+/**
+ * \file devices.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_HAL_NATIVE_SIM_DEVICES_HPP_
+#define INCLUDE_COSM_HAL_NATIVE_SIM_DEVICES_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <limits>
+#include <vector>
+
+#include <boost/range/iterator_range.hpp>
+
+#include "rcppsw/utils/color.hpp"
+#include "rcppsw/math/vector2.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/hal/native_sim/world.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, hal, native_sim);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class device
+ * \ingroup hal native_sim
+ *
+ * \brief Base class for the sensor/actuator handles of the \c native-sim HAL
+ * target, which are what the HAL \c *_impl<> wrappers are instantiated with
+ * (analogous to the ARGoS control interfaces). Each handle is bound to a
+ * single robot in a \ref world.
+ *
+ * Readings are written into buffers owned by each handle, so that reading
+ * sensors does not allocate once the buffers have grown to size.
+ *
+ * All angles in readings are relative to the robot's heading, in [-pi, pi].
+ */
+class device {
+ public:
+  device(world* const world, size_t robot_id)
+      : m_world(world), m_robot_id(robot_id) {}
+
+  size_t robot_id(void) const { return m_robot_id; }
+
+ protected:
+  const robot_state& state(void) const { return m_world->robot(m_robot_id); }
+  robot_state& state(void) { return m_world->robot(m_robot_id); }
+  const world* sim(void) const { return m_world; }
+
+  /**
+   * \brief Convert an absolute angle to one relative to the robot's heading.
+   */
+  double relative(double angle) const {
+    return std::remainder(angle - state().heading, 2 * M_PI);
+  }
+
+ private:
+  /* clang-format off */
+  world* const m_world;
+  size_t       m_robot_id;
+  /* clang-format on */
+};
+
+/**
+ * \class proximity_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Senses the arena walls and other robots within range of the robot
+ * body. Rather than a fixed ring of sensors, there is one reading per detected
+ * object, with value 1.0 when touching and 0.0 at the edge of the range.
+ */
+class proximity_sensor : public device {
+ public:
+  struct reading {
+    double value;
+    double angle;
+  };
+  using device::device;
+
+  const std::vector<reading>& readings(void) const;
+
+ private:
+  /* clang-format off */
+  mutable std::vector<reading> m_readings{};
+  /* clang-format on */
+};
+
+/**
+ * \class light_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Senses each light in the world within range, with value 1.0 at the
+ * light and 0.0 at the edge of the range.
+ */
+class light_sensor : public device {
+ public:
+  struct reading {
+    double value;
+    double angle;
+  };
+  using device::device;
+
+  const std::vector<reading>& readings(void) const;
+  void enable(void) { m_enabled = true; }
+  void disable(void) { m_enabled = false; }
+
+ private:
+  /* clang-format off */
+  bool                         m_enabled{true};
+  mutable std::vector<reading> m_readings{};
+  /* clang-format on */
+};
+
+/**
+ * \class ground_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Four ground sensors under the robot body at +/-45 and +/-135 degrees
+ * which read the floor value of the world beneath them.
+ */
+class ground_sensor : public device {
+ public:
+  struct reading {
+    double value;
+    double distance;
+  };
+  using device::device;
+
+  const std::vector<reading>& readings(void) const;
+
+ private:
+  /* clang-format off */
+  mutable std::vector<reading> m_readings{};
+  /* clang-format on */
+};
+
+/**
+ * \class position_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Reports the exact position and heading of the robot.
+ */
+class position_sensor : public device {
+ public:
+  struct reading {
+    rmath::vector2d position;
+    double heading;
+  };
+  using device::device;
+
+  reading get_reading(void) const { return {state().pos, state().heading}; }
+};
+
+/**
+ * \class battery_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Battery drain is not modeled, so the battery is always full.
+ */
+class battery_sensor : public device {
+ public:
+  struct reading {
+    double available_charge;
+    double time_left;
+  };
+  using device::device;
+
+  reading get_reading(void) const {
+    return {1.0, std::numeric_limits<double>::infinity()};
+  }
+};
+
+/**
+ * \class diff_drive_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Reports the wheel speeds of the robot, and the distance covered by
+ * each wheel during the last step.
+ */
+class diff_drive_sensor : public device {
+ public:
+  struct reading {
+    double vel_left;
+    double vel_right;
+    double dist_left;
+    double dist_right;
+    double axle_length;
+  };
+  using device::device;
+
+  reading get_reading(void) const {
+    return {state().vel_left,
+            state().vel_right,
+            state().dist_left,
+            state().dist_right,
+            sim()->config()->axle_length};
+  }
+};
+
+/**
+ * \class colored_blob_camera_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Sees the LEDs of other robots within range which are not turned off
+ * (i.e., not black).
+ */
+class colored_blob_camera_sensor : public device {
+ public:
+  struct reading {
+    double distance;
+    double angle;
+    rutils::color color;
+  };
+  using device::device;
+
+  const std::vector<reading>& readings(void) const;
+  void enable(void) { m_enabled = true; }
+  void disable(void) { m_enabled = false; }
+
+ private:
+  /* clang-format off */
+  bool                         m_enabled{true};
+  mutable std::vector<reading> m_readings{};
+  /* clang-format on */
+};
+
+/**
+ * \class wifi_sensor
+ * \ingroup hal native_sim
+ *
+ * \brief Receives the data broadcast by all other robots within range.
+ *
+ * Payload buffers are kept across calls up to the most readings ever
+ * received, so that their storage is reused even if fewer robots are in range
+ * than last time.
+ */
+class wifi_sensor : public device {
+ public:
+  using payload_vector = std::vector<std::vector<uint8_t>>;
+  using reading_range = boost::iterator_range<payload_vector::const_iterator>;
+
+  using device::device;
+
+  /**
+   * \brief Get the payloads received this timestep, which are only valid until
+   * the next call.
+   */
+  reading_range readings(void) const;
+
+ private:
+  /* clang-format off */
+  mutable payload_vector m_readings{};
+  mutable size_t         m_n_readings{0};
+  /* clang-format on */
+};
+
+/**
+ * \class diff_drive_actuator
+ * \ingroup hal native_sim
+ *
+ * \brief Sets the linear speed of each wheel of the robot (in meters per
+ * second), which takes effect at the next \ref world::step().
+ */
+class diff_drive_actuator : public device {
+ public:
+  using device::device;
+
+  void set_linear_velocity(double left, double right) {
+    state().vel_left = left;
+    state().vel_right = right;
+  }
+};
+
+/**
+ * \class led_actuator
+ * \ingroup hal native_sim
+ *
+ * \brief Sets the color of the LEDs of the robot, which are modeled as a
+ * single LED.
+ */
+class led_actuator : public device {
+ public:
+  using device::device;
+
+  void set_color(const rutils::color& color) { state().led = color; }
+};
+
+/**
+ * \class wifi_actuator
+ * \ingroup hal native_sim
+ *
+ * \brief Sets the data broadcast by the robot.
+ */
+class wifi_actuator : public device {
+ public:
+  using device::device;
+
+  void set_data(const std::vector<uint8_t>& data) { state().wifi_data = data; }
+  void clear_data(void) { state().wifi_data.clear(); }
+};
+
+NS_END(native_sim, hal, cosm);
+
+#endif /* INCLUDE_COSM_HAL_NATIVE_SIM_DEVICES_HPP_ */
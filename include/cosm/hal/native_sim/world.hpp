@@ -0,0 +1,255 @@
+/**
+ * \file world.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_HAL_NATIVE_SIM_WORLD_HPP_
+#define INCLUDE_COSM_HAL_NATIVE_SIM_WORLD_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/utils/color.hpp"
+
+#include "cosm/cosm.hpp"
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/hal/native_sim/config/world_config.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, hal, native_sim);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct robot_state
+ * \ingroup hal native_sim
+ *
+ * \brief The complete simulated state of a single robot. Everything the
+ * native-sim devices read/write for a robot lives here.
+ */
+struct robot_state {
+  rmath::vector2d      pos{};
+  double               heading{0.0};
+  double               vel_left{0.0};
+  double               vel_right{0.0};
+  double               dist_left{0.0};
+  double               dist_right{0.0};
+
+  /* What the robot's actuators have set during the current step */
+  rutils::color        led{rutils::color::kBLACK};
+  std::vector<uint8_t> wifi_data{};
+
+  /*
+   * What other robots see/receive during the current step: what was set during
+   * the previous step, as with ARGoS, so that controllers can be run in
+   * parallel.
+   */
+  rutils::color        led_visible{rutils::color::kBLACK};
+  std::vector<uint8_t> wifi_visible{};
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class world
+ * \ingroup hal native_sim
+ *
+ * \brief A lightweight in-process world for the \c native-sim HAL target:
+ * differential drive kinematics for a set of circular robots within the
+ * rectangular extent of an \ref cds::arena_grid, plus point light sources and
+ * a floor painted per grid cell.
+ *
+ * There is no physics: robots do not collide with each other, and are simply
+ * clamped to the arena boundaries. Robots within sensing range of each other
+ * are found via a uniform bucket grid rebuilt each step, so a step is O(N) in
+ * the # of robots for bounded densities.
+ */
+class world : public rer::client<world> {
+ public:
+  using control_step_cb_type = std::function<void(size_t)>;
+
+  world(const config::world_config* config, const cds::arena_grid* grid);
+
+  world(const world&) = delete;
+  const world& operator=(const world&) = delete;
+
+  /**
+   * \brief Add a robot to the world.
+   *
+   * \return The ID of the new robot, which is also its index for \ref robot().
+   */
+  size_t robot_add(const rmath::vector2d& pos, double heading);
+
+  /**
+   * \brief Add a point light source at the specified location.
+   */
+  void light_add(const rmath::vector2d& pos) { m_lights.push_back(pos); }
+
+  /**
+   * \brief Set the floor value of all cells within the (inclusive) cell
+   * bounds, e.g., to mark the nest.
+   */
+  void floor_fill(const rmath::vector2z& ll,
+                  const rmath::vector2z& ur,
+                  double value);
+
+  /**
+   * \brief Run the specified # of steps: at each step, run the control step
+   * for each robot (in parallel), and then integrate robot motion via \ref
+   * step().
+   */
+  void run(size_t n_steps, const control_step_cb_type& control_step);
+
+  /**
+   * \brief Integrate robot motion over a single step, and make the LED/wifi
+   * state set during the step visible to other robots.
+   *
+   * Robots have moved afterwards, so \ref buckets_update() must be called
+   * before robots are next sensed via \ref neighbors_visit() (\ref run() does
+   * this).
+   */
+  void step(void);
+
+  /**
+   * \brief Re-sort robots into buckets by position if any robot has been
+   * added or moved since they were last sorted. Must not be called
+   * concurrently with \ref neighbors_visit().
+   */
+  void buckets_update(void) {
+    if (m_buckets_dirty) {
+      buckets_rebuild();
+      m_buckets_dirty = false;
+    }
+  }
+
+  size_t n_robots(void) const { return m_robots.size(); }
+  size_t steps(void) const { return m_steps; }
+  robot_state& robot(size_t id) { return m_robots[id]; }
+  const robot_state& robot(size_t id) const { return m_robots[id]; }
+  const config::world_config* config(void) const { return &mc_config; }
+  const std::vector<rmath::vector2d>& lights(void) const { return m_lights; }
+
+  /**
+   * \brief Get the floor value at the specified location, or the configured
+   * default if it is out of bounds.
+   */
+  double floor_value(const rmath::vector2d& pos) const;
+
+  /**
+   * \brief Visit each arena boundary within the specified range of the center
+   * of the specified robot.
+   *
+   * \param f Callback taking (distance, absolute angle).
+   */
+  template <typename TFunc>
+  void walls_visit(size_t id, double range, const TFunc& f) const {
+    const auto& pos = m_robots[id].pos;
+    if (pos.x() <= range) {
+      f(pos.x(), M_PI);
+    }
+    if (mc_grid->xrsize() - pos.x() <= range) {
+      f(mc_grid->xrsize() - pos.x(), 0.0);
+    }
+    if (pos.y() <= range) {
+      f(pos.y(), -M_PI / 2.0);
+    }
+    if (mc_grid->yrsize() - pos.y() <= range) {
+      f(mc_grid->yrsize() - pos.y(), M_PI / 2.0);
+    }
+  }
+
+  /**
+   * \brief Visit all robots other than the specified robot whose centers are
+   * within the specified range of its center.
+   *
+   * \param f Callback taking (other robot ID, distance, absolute angle).
+   */
+  template <typename TFunc>
+  void neighbors_visit(size_t id, double range, const TFunc& f) const {
+    ER_ASSERT(!m_buckets_dirty, "Robot buckets not updated before sensing");
+    const auto& pos = m_robots[id].pos;
+    auto span = static_cast<long>(std::ceil(range / m_bucket_dim));
+    auto center = bucket_of(pos);
+    for (long i = center.first - span; i <= center.first + span; ++i) {
+      for (long j = center.second - span; j <= center.second + span; ++j) {
+        if (i < 0 || j < 0 || i >= static_cast<long>(m_xbuckets) ||
+            j >= static_cast<long>(m_ybuckets)) {
+          continue;
+        }
+        size_t bucket = static_cast<size_t>(i) * m_ybuckets +
+                        static_cast<size_t>(j);
+        for (size_t k = m_bucket_starts[bucket];
+             k < m_bucket_starts[bucket + 1];
+             ++k) {
+          size_t other = m_bucket_ids[k];
+          if (other == id) {
+            continue;
+          }
+          auto diff = m_robots[other].pos - pos;
+          double dist = diff.length();
+          if (dist <= range) {
+            f(other, dist, std::atan2(diff.y(), diff.x()));
+          }
+        } /* for(k..) */
+      } /* for(j..) */
+    } /* for(i..) */
+  }
+
+ private:
+  std::pair<long, long> bucket_of(const rmath::vector2d& pos) const;
+
+  /**
+   * \brief Counting sort of robots into buckets by position, reusing the
+   * storage from the previous sort.
+   */
+  void buckets_rebuild(void);
+
+  /* clang-format off */
+  const config::world_config   mc_config;
+  const cds::arena_grid* const mc_grid;
+
+  size_t                       m_steps{0};
+  std::vector<robot_state>     m_robots{};
+  std::vector<rmath::vector2d> m_lights{};
+  std::vector<double>          m_floor;
+
+  double                       m_bucket_dim;
+  size_t                       m_xbuckets;
+  size_t                       m_ybuckets;
+  bool                         m_buckets_dirty{true};
+  std::vector<size_t>          m_bucket_starts{};
+  std::vector<size_t>          m_bucket_ids{};
+  std::vector<size_t>          m_robot_buckets{};
+  std::vector<size_t>          m_bucket_fill{};
+  /* clang-format on */
+};
+
+NS_END(native_sim, hal, cosm);
+
+#endif /* INCLUDE_COSM_HAL_NATIVE_SIM_WORLD_HPP_ */
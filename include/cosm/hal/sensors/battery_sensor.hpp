@@ -28,6 +28,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_battery_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no battery sensor!"
 #endif /* HAL_TARGET */
@@ -40,9 +42,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_battery_sensor = std::is_same<TSensor,
                                              argos::CCI_BatterySensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_battery_sensor = std::is_same<TSensor,
+                                                  native_sim::battery_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -56,6 +64,7 @@ NS_END(detail);
  * \brief Battery sensor wrapper for the following supported robots:
  *
  * - ARGoS footbot
+ * - native-sim robot (battery drain is not modeled)
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
@@ -81,6 +90,7 @@ class battery_sensor_impl {
 
   explicit battery_sensor_impl(TSensor * const sensor) : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current battery sensor reading for the footbot robot.
    */
@@ -90,6 +100,17 @@ class battery_sensor_impl {
     argos::CCI_BatterySensor::SReading temp = m_sensor->GetReading();
     return {temp.AvailableCharge, temp.TimeLeft};
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current battery sensor reading for the native-sim robot.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_battery_sensor<U>::value)>
+  sensor_reading reading(void) const {
+    auto temp = m_sensor->get_reading();
+    return {temp.available_charge, temp.time_left};
+  }
+#endif /* HAL_TARGET */
 
  private:
   /* clang-format off */
@@ -99,6 +120,8 @@ class battery_sensor_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using battery_sensor = battery_sensor_impl<argos::CCI_BatterySensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using battery_sensor = battery_sensor_impl<native_sim::battery_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
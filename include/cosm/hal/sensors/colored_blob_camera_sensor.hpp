@@ -33,6 +33,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_colored_blob_omnidirectional_camera_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no blob camera sensor!"
 #endif /* HAL_TARGET */
@@ -45,10 +47,17 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_blob_camera_sensor = std::is_same<
   TSensor,
   argos::CCI_ColoredBlobOmnidirectionalCameraSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_blob_camera_sensor = std::is_same<
+  TSensor,
+  native_sim::colored_blob_camera_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -67,6 +76,8 @@ NS_END(detail);
  *   so it is disabled upon creation, so robots can selectively enable/disable
  *   it as needed for maximum speed.
  *
+ * - native-sim robot.
+ *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
  *                  at compile time, and SFINAE ensures no member functions can
@@ -86,15 +97,17 @@ class colored_blob_camera_sensor_impl {
   explicit colored_blob_camera_sensor_impl(TSensor * const sensor)
       : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the sensor readings for the footbot robot.
    *
-   * \return A vector of \ref reading.
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
    */
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_blob_camera_sensor<U>::value)>
-  std::vector<reading>  readings(void) const {
-    std::vector<reading> ret;
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
     for (auto &r : m_sensor->GetReadings().BlobList) {
       struct reading s = {
         .vec = {r->Distance, rmath::radians(r->Angle.GetValue())},
@@ -102,10 +115,10 @@ class colored_blob_camera_sensor_impl {
                               r->Color.GetGreen(),
                               r->Color.GetBlue())
       };
-      ret.push_back(s);
+      m_readings.push_back(s);
     } /* for(&r..) */
 
-    return ret;
+    return m_readings;
   }
 
   template <typename U = TSensor,
@@ -115,14 +128,44 @@ class colored_blob_camera_sensor_impl {
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_blob_camera_sensor<U>::value)>
   void disable(void) const { m_sensor->Disable(); }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the sensor readings for the native-sim robot.
+   *
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_blob_camera_sensor<U>::value)>
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
+    for (auto &r : m_sensor->readings()) {
+      m_readings.push_back({{r.distance, rmath::radians(r.angle)}, r.color});
+    } /* for(&r..) */
+
+    return m_readings;
+  }
+
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_blob_camera_sensor<U>::value)>
+  void enable(void) const { m_sensor->enable(); }
+
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_blob_camera_sensor<U>::value)>
+  void disable(void) const { m_sensor->disable(); }
+#endif /* HAL_TARGET */
 
  private:
   TSensor* const m_sensor;
+  mutable std::vector<reading> m_readings{};
 };
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using colored_blob_camera_sensor =
     colored_blob_camera_sensor_impl<argos::CCI_ColoredBlobOmnidirectionalCameraSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using colored_blob_camera_sensor =
+    colored_blob_camera_sensor_impl<native_sim::colored_blob_camera_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -29,6 +29,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_differential_steering_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no differential drive sensor!"
 #endif /* HAL_TARGET */
@@ -41,9 +43,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename T>
 using is_argos_ds_sensor = std::is_same<T,
                                           argos::CCI_DifferentialSteeringSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename T>
+using is_native_sim_ds_sensor = std::is_same<T,
+                                             native_sim::diff_drive_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -59,6 +67,7 @@ NS_END(detail);
  * Supports the following robots:
  *
  * - ARGoS footbot
+ * - native-sim robot
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                 HAL. If nullptr, then that effectively disables the sensor
@@ -78,6 +87,7 @@ class diff_drive_sensor_impl {
 
   explicit diff_drive_sensor_impl(TSensor* const sensor) : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current battery sensor reading for the footbot robot.
    */
@@ -91,13 +101,26 @@ class diff_drive_sensor_impl {
           tmp.CoveredDistanceRightWheel,
           tmp.WheelAxisLength};
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current sensor reading for the native-sim robot.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_ds_sensor<U>::value)>
+  sensor_reading reading(void) const {
+    auto tmp = m_sensor->get_reading();
+    return {tmp.vel_left,
+          tmp.vel_right,
+          tmp.dist_left,
+          tmp.dist_right,
+          tmp.axle_length};
+  }
+#endif /* HAL_TARGET */
 
   /**
    * \brief Return the current speed of the robot (average of the 2 wheel
    * speeds).
    */
-  template <typename U = TSensor,
-            RCPPSW_SFINAE_FUNC(detail::is_argos_ds_sensor<U>::value)>
   double current_speed(void) const {
     auto tmp = reading();
     return (tmp.vel_left + tmp.vel_right) / 2.0;
@@ -113,6 +136,8 @@ class diff_drive_sensor_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using diff_drive_sensor = diff_drive_sensor_impl<argos::CCI_DifferentialSteeringSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using diff_drive_sensor = diff_drive_sensor_impl<native_sim::diff_drive_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -35,6 +35,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/foot-bot/control_interface/ci_footbot_motor_ground_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no ground sensor!"
 #endif /* HAL_TARGET */
@@ -47,9 +49,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_ground_sensor = std::is_same<TSensor,
                                             argos::CCI_FootBotMotorGroundSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_ground_sensor = std::is_same<TSensor,
+                                                 native_sim::ground_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -63,6 +71,7 @@ NS_END(detail);
  * \brief Ground sensor wrapper for the following supported robots:
  *
  * - ARGoS footbot
+ * - native-sim robot
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
@@ -99,21 +108,40 @@ class ground_sensor_impl : public rer::client<ground_sensor_impl<TSensor>> {
   const ground_sensor_impl& operator=(const ground_sensor_impl&) = delete;
   ground_sensor_impl(const ground_sensor_impl&) = default;
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current ground sensor readings for the footbot robot.
    *
-   * \return A vector of \ref reading.
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
    */
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_ground_sensor<U>::value)>
-  std::vector<reading> readings(void) const {
-    std::vector<reading> ret;
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
     for (auto &r : m_sensor->GetReadings()) {
-      ret.emplace_back(r.Value, -1.0);
+      m_readings.emplace_back(r.Value, -1.0);
     } /* for(&r..) */
 
-    return ret;
+    return m_readings;
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current ground sensor readings for the native-sim robot.
+   *
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_ground_sensor<U>::value)>
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
+    for (auto &r : m_sensor->readings()) {
+      m_readings.emplace_back(r.value, r.distance);
+    } /* for(&r..) */
+    return m_readings;
+  }
+#endif /* HAL_TARGET */
 
   /**
    * \brief Detect if a certain condition is met by examining footbot ground
@@ -123,8 +151,6 @@ class ground_sensor_impl : public rer::client<ground_sensor_impl<TSensor>> {
    *
    * \return \c TRUE iff the condition was detected by the specified # readings.
    */
-  template <typename U = TSensor,
-            RCPPSW_SFINAE_FUNC(detail::is_argos_ground_sensor<U>::value)>
   bool detect(const std::string& name) const {
     ER_ASSERT(mc_config.detect_map.end() != mc_config.detect_map.find(name),
               "Detection %s not found in configured map",
@@ -142,11 +168,14 @@ class ground_sensor_impl : public rer::client<ground_sensor_impl<TSensor>> {
   /* clang-format off */
   const config::ground_sensor_config mc_config;
   TSensor* const                     m_sensor;
+  mutable std::vector<reading>       m_readings{};
   /* clang-format on */
 };
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using ground_sensor = ground_sensor_impl<argos::CCI_FootBotMotorGroundSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using ground_sensor = ground_sensor_impl<native_sim::ground_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -30,6 +30,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/foot-bot/control_interface/ci_footbot_light_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no light sensor!"
 #endif /* HAL_TARGET */
@@ -42,9 +44,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_light_sensor = std::is_same<TSensor,
                                            argos::CCI_FootBotLightSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_light_sensor = std::is_same<TSensor,
+                                                native_sim::light_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -63,6 +71,8 @@ NS_END(detail);
  *   so it is disabled upon creation, so robots can selectively enable/disable
  *   it as needed for maximum speed.
  *
+ * - native-sim robot.
+ *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
  *                  at compile time, and SFINAE ensures no member functions can
@@ -87,20 +97,22 @@ class light_sensor_impl {
 
   explicit light_sensor_impl(TSensor * const sensor) : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current light sensor readings for the footbot robot.
    *
-   * \return A vector of \ref reading.
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
    */
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_light_sensor<U>::value)>
-  std::vector<reading>  readings(void) const {
-    std::vector<reading> ret;
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
     for (auto &r : m_sensor->GetReadings()) {
-      ret.push_back({r.Value, r.Angle.GetValue()});
+      m_readings.push_back({r.Value, r.Angle.GetValue()});
     } /* for(&r..) */
 
-    return ret;
+    return m_readings;
   }
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_light_sensor<U>::value)>
@@ -109,15 +121,43 @@ class light_sensor_impl {
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_light_sensor<U>::value)>
   void disable(void) const { m_sensor->Disable(); }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current light sensor readings for the native-sim robot.
+   *
+   * \return A vector of \ref reading. The vector is reused across calls
+   * to avoid allocation, so it is only valid until the next call.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_light_sensor<U>::value)>
+  const std::vector<reading>& readings(void) const {
+    m_readings.clear();
+    for (auto &r : m_sensor->readings()) {
+      m_readings.push_back({r.value, r.angle});
+    } /* for(&r..) */
+    return m_readings;
+  }
+
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_light_sensor<U>::value)>
+  void enable(void) const { m_sensor->enable(); }
+
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_light_sensor<U>::value)>
+  void disable(void) const { m_sensor->disable(); }
+#endif /* HAL_TARGET */
 
  private:
   /* clang-format off */
-  TSensor* const m_sensor;
+  TSensor* const               m_sensor;
+  mutable std::vector<reading> m_readings{};
   /* clang-format on */
 };
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using light_sensor = light_sensor_impl<argos::CCI_FootBotLightSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using light_sensor = light_sensor_impl<native_sim::light_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -32,6 +32,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_positioning_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no position sensor!"
 #endif /* HAL_TARGET */
@@ -44,9 +46,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_position_sensor = std::is_same<TSensor,
                                            argos::CCI_PositioningSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_position_sensor = std::is_same<TSensor,
+                                                   native_sim::position_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -62,6 +70,7 @@ NS_END(detail);
  * Supports the following robots:
  *
  * - ARGoS footbot.
+ * - native-sim robot.
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                 HAL. If nullptr, then that effectively disables the sensor
@@ -84,6 +93,7 @@ class position_sensor_impl {
 
   explicit position_sensor_impl(TSensor * const sensor) : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current position sensor readings for the footbot robot.
    *
@@ -104,6 +114,23 @@ class position_sensor_impl {
                                    tmp.Position.GetZ());
     return ret;
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current position sensor readings for the native-sim robot,
+   * which moves in the plane, so only the Z angle is ever non-zero.
+   *
+   * \return A \ref sensor_reading.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_position_sensor<U>::value)>
+  sensor_reading reading(void) const {
+    auto tmp = m_sensor->get_reading();
+    sensor_reading ret;
+    ret.z_ang = rmath::radians(tmp.heading);
+    ret.position = rmath::vector3d(tmp.position.x(), tmp.position.y(), 0.0);
+    return ret;
+  }
+#endif /* HAL_TARGET */
 
  private:
   /* clang-format off */
@@ -113,6 +140,8 @@ class position_sensor_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using position_sensor = position_sensor_impl<argos::CCI_PositioningSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using position_sensor = position_sensor_impl<native_sim::position_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -37,6 +37,8 @@
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/foot-bot/control_interface/ci_footbot_proximity_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no proximity sensor!"
 #endif /* HAL_TARGET */
@@ -49,9 +51,15 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_proximity_sensor = std::is_same<TSensor,
                                                argos::CCI_FootBotProximitySensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_proximity_sensor = std::is_same<TSensor,
+                                                    native_sim::proximity_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -67,6 +75,7 @@ NS_END(detail);
  * Supports the following robots:
  *
  * - ARGoS footbot
+ * - native-sim robot
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
@@ -76,8 +85,6 @@ NS_END(detail);
 template <typename TSensor>
 class proximity_sensor_impl {
  public:
-  template <typename U = TSensor,
-            RCPPSW_SFINAE_FUNC(detail::is_argos_proximity_sensor<U>::value)>
    proximity_sensor_impl(TSensor * const sensor,
                      const config::proximity_sensor_config* const config)
       : mc_config(*config),
@@ -96,13 +103,8 @@ class proximity_sensor_impl {
    * such that the average distance to them is > than the provided delta,
    * nothing is returned
    */
-  template <typename U = TSensor,
-            RCPPSW_SFINAE_FUNC(detail::is_argos_proximity_sensor<U>::value)>
   boost::optional<rmath::vector2d> avg_prox_obj(void) const {
-    rmath::vector2d accum;
-    for (auto& r : readings()) {
-      accum += r;
-    }
+    rmath::vector2d accum = readings_sum();
     if (mc_config.fov.contains(accum.angle()) &&
         accum.length() <= mc_config.delta) {
       return boost::optional<rmath::vector2d>();
@@ -112,22 +114,37 @@ class proximity_sensor_impl {
   }
 
  private:
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
-   * \brief Get the current proximity sensor readings for the footbot robot.
-   *
-   * \return A vector of (X,Y) pairs of sensor readings corresponding to
-   * object distances.
+   * \brief Get the sum of the current proximity sensor readings for the
+   * footbot robot as (X,Y) vectors, directly from the underlying reading array.
    */
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_proximity_sensor<U>::value)>
-  std::vector<rmath::vector2d> readings(void) const {
-    std::vector<rmath::vector2d> ret;
+  rmath::vector2d readings_sum(void) const {
+    rmath::vector2d accum;
     for (auto &r : m_sensor->GetReadings()) {
-      ret.emplace_back(r.Value, rmath::radians(r.Angle.GetValue()));
+      accum += rmath::vector2d(r.Value, rmath::radians(r.Angle.GetValue()));
+    } /* for(&r..) */
+
+    return accum;
+  }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the sum of the current proximity sensor readings for the
+   * native-sim robot as (X,Y) vectors.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_proximity_sensor<U>::value)>
+  rmath::vector2d readings_sum(void) const {
+    rmath::vector2d accum;
+    for (auto &r : m_sensor->readings()) {
+      accum += rmath::vector2d(r.value, rmath::radians(r.angle));
     } /* for(&r..) */
 
-    return ret;
+    return accum;
   }
+#endif /* HAL_TARGET */
 
   /* clang-format off */
   const config::proximity_sensor_config mc_config;
@@ -137,6 +154,8 @@ class proximity_sensor_impl {
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using proximity_sensor = proximity_sensor_impl<argos::CCI_FootBotProximitySensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using proximity_sensor = proximity_sensor_impl<native_sim::proximity_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
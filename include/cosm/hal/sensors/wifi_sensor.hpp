@@ -25,11 +25,16 @@
  * Includes
  ******************************************************************************/
 #include <vector>
+
+#include <boost/range/iterator_range.hpp>
+
 #include "cosm/hal/wifi_packet.hpp"
 #include "rcppsw/math/radians.hpp"
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 #include <argos3/plugins/robots/generic/control_interface/ci_range_and_bearing_sensor.h>
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include "cosm/hal/native_sim/devices.hpp"
 #else
 #error "Selected hardware has no RAB wireless communication sensor!"
 #endif /* HAL_TARGET */
@@ -42,9 +47,14 @@ NS_START(cosm, hal, sensors, detail);
 /*******************************************************************************
  * Templates
  ******************************************************************************/
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 template<typename TSensor>
 using is_argos_sensor = std::is_same<TSensor,
                                          argos::CCI_RangeAndBearingSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+template<typename TSensor>
+using is_native_sim_sensor = std::is_same<TSensor, native_sim::wifi_sensor>;
+#endif /* HAL_TARGET */
 
 NS_END(detail);
 
@@ -59,6 +69,7 @@ NS_END(detail);
  * the following supported robots:
  *
  * - ARGoS footbot
+ * - native-sim robot
  *
  * \tparam TSensor The underlying sensor handle type abstracted away by the
  *                  HAL. If nullptr, then that effectively disables the sensor
@@ -68,33 +79,71 @@ NS_END(detail);
 template <typename TSensor>
 class wifi_sensor_impl  {
  public:
+  using packet_range =
+      boost::iterator_range<typename std::vector<wifi_packet>::const_iterator>;
+
   explicit wifi_sensor_impl(TSensor * const sensor) : m_sensor(sensor) {}
 
+#if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
   /**
    * \brief Get the current rab wifi sensor readings for the footbot robot.
    *
-   * \return A vector of \ref wifi_packet.
+   * \return A range of \ref wifi_packet. The packets (and their payloads)
+   * are reused across calls to avoid allocation, so they are only valid until
+   * the next call.
    */
   template <typename U = TSensor,
             RCPPSW_SFINAE_FUNC(detail::is_argos_sensor<U>::value)>
-  std::vector<wifi_packet> readings(void) const {
-    std::vector<wifi_packet> ret;
-    for (auto &r : m_sensor->GetReadings()) {
-      wifi_packet d;
-      for (size_t i = 0; i < r.Data.Size(); ++i) {
-        d.data.push_back(r.Data[i]);
-      } /* for(i..) */
-      ret.push_back(d);
-    } /* for(&r..) */
-    return ret;
+  packet_range readings(void) const {
+    auto& readings = m_sensor->GetReadings();
+    packets_reserve(readings.size());
+    for (size_t i = 0; i < readings.size(); ++i) {
+      auto& data = readings[i].Data;
+      m_packets[i].data.assign(data.ToCArray(), data.ToCArray() + data.Size());
+    } /* for(i..) */
+    return { m_packets.cbegin(), m_packets.cbegin() + readings.size() };
   }
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+  /**
+   * \brief Get the current wifi sensor readings for the native-sim robot.
+   *
+   * \return A range of \ref wifi_packet. The packets (and their payloads)
+   * are reused across calls to avoid allocation, so they are only valid until
+   * the next call.
+   */
+  template <typename U = TSensor,
+            RCPPSW_SFINAE_FUNC(detail::is_native_sim_sensor<U>::value)>
+  packet_range readings(void) const {
+    auto readings = m_sensor->readings();
+    packets_reserve(readings.size());
+    for (size_t i = 0; i < readings.size(); ++i) {
+      m_packets[i].data.assign(readings[i].begin(), readings[i].end());
+    } /* for(i..) */
+    return { m_packets.cbegin(), m_packets.cbegin() + readings.size() };
+  }
+#endif /* HAL_TARGET */
 
  private:
-  TSensor* m_sensor;
+  /**
+   * \brief Grow the packet buffer to hold at least \p n packets. It is never
+   * shrunk, so that packet payload storage is reused across calls.
+   */
+  void packets_reserve(size_t n) const {
+    if (m_packets.size() < n) {
+      m_packets.resize(n);
+    }
+  }
+
+  /* clang-format off */
+  TSensor*                         m_sensor;
+  mutable std::vector<wifi_packet> m_packets{};
+  /* clang-format on */
 };
 
 #if COSM_HAL_TARGET == HAL_TARGET_ARGOS_FOOTBOT
 using wifi_sensor = wifi_sensor_impl<argos::CCI_RangeAndBearingSensor>;
+#elif COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+using wifi_sensor = wifi_sensor_impl<native_sim::wifi_sensor>;
 #endif /* HAL_TARGET */
 
 NS_END(sensors, hal, cosm);
@@ -165,10 +165,28 @@ class base_metrics_aggregator : public rer::client<base_metrics_aggregator> {
 
   /**
    * \brief Decorator around \ref collector_group::get().
+   *
+   * \return The collector registered as \p key, or NULL if there is none.
+   */
+  template <typename T>
+  const T* get(const std::string& key) const {
+    auto it = m_collector_map.find(key);
+    if (it != m_collector_map.end()) {
+      return it->second->template get<T>(key);
+    }
+    return nullptr;
+  }
+
+  /**
+   * \brief Get a collector in order to modify it (e.g. to change its output
+   * after registration). The aggregator owns all of its collectors, so a
+   * non-const aggregator can hand them out as non-const; \ref
+   * collector_group::get() only returns const collectors.
    */
   template <typename T>
-  const T* get(const std::string& key) {
-    return m_collector_map[key]->get<T>(key);
+  T* get(const std::string& key) {
+    return const_cast<T*>(
+        static_cast<const base_metrics_aggregator*>(this)->get<T>(key));
   }
 
   bool metrics_write(rmetrics::output_mode mode) {
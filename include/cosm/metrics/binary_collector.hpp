@@ -0,0 +1,110 @@
+/**
+ * \file binary_collector.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_BINARY_COLLECTOR_HPP_
+#define INCLUDE_COSM_METRICS_BINARY_COLLECTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cosm/cosm.hpp"
+#include "cosm/metrics/binary_sink.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class binary_collector
+ * \ingroup metrics
+ *
+ * \brief Mixin for metrics collectors which can write their output via a \ref
+ * binary_sink instead of as .csv.
+ *
+ * Once binary output is enabled, derived collectors append a row of values to
+ * \ref binary_output() each time they would otherwise build a .csv line, and
+ * return no line, so nothing besides the header is written to the .csv file.
+ */
+class binary_collector {
+ public:
+  binary_collector(void) = default;
+  virtual ~binary_collector(void) = default;
+
+  binary_collector(const binary_collector&) = delete;
+  binary_collector& operator=(const binary_collector&) = delete;
+
+  /**
+   * \brief Write output to <fpath_stem>.bin instead of <fpath_stem>.csv,
+   * using the same output \p mode as the .csv file would have.
+   */
+  void binary_output_enable(const std::string& fpath_stem,
+                            const rmetrics::output_mode& mode) {
+    auto cols = binary_cols();
+    m_row.reserve(cols.size());
+    m_sink = std::make_unique<binary_sink>(fpath_stem + binary_sink::kExtension,
+                                           cols,
+                                           mode);
+  }
+  bool binary_output_enabled(void) const { return nullptr != m_sink; }
+
+ protected:
+  /**
+   * \brief The names of the columns in the binary output, in the order that
+   * values are appended to each row.
+   */
+  virtual std::vector<std::string> binary_cols(void) const = 0;
+
+  /**
+   * \brief Append a row containing \p values, in column order, to the binary
+   * output. The same row buffer is reused for every row.
+   */
+  template <typename... Args>
+  void binary_row_append(const Args&... values) {
+    m_row.clear();
+    (m_row.push_back(static_cast<double>(values)), ...);
+    m_sink->row_append(m_row);
+  }
+
+  /**
+   * \brief Numeric equivalent of the .csv average entries: \p sum / \p count,
+   * or 0 if \p count is 0.
+   */
+  static double binary_avg(double sum, double count) {
+    return (count > 0) ? sum / count : 0.0;
+  }
+
+ private:
+  /* clang-format off */
+  std::unique_ptr<binary_sink> m_sink{nullptr};
+  std::vector<double>          m_row{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_BINARY_COLLECTOR_HPP_ */
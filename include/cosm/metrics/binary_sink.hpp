@@ -0,0 +1,172 @@
+/**
+ * \file binary_sink.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_BINARY_SINK_HPP_
+#define INCLUDE_COSM_METRICS_BINARY_SINK_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/metrics/base_metrics_collector.hpp"
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class binary_sink
+ * \ingroup metrics
+ *
+ * \brief Compact, append-only, columnar output for metrics collectors, as an
+ * alternative to writing .csv files (no string formatting when collecting, and
+ * much smaller files).
+ *
+ * File layout (all integers/values are in native byte order):
+ *
+ * - Header: the 8 byte magic \ref kMagic, the # of columns (u32), and then for
+ *   each column its type (u8, one of \ref column_type) and its name (u32 length
+ *   + characters).
+ *
+ * - Any # of blocks, each containing the # of rows in the block (u32) followed
+ *   by the values for each column in order (i.e. column major within a
+ *   block).
+ *
+ * Rows are buffered in memory, and full blocks are written by a background
+ * thread so that collectors do not wait on file I/O. Use \ref to_csv() to
+ * convert a file to .csv.
+ */
+class binary_sink : public rer::client<binary_sink> {
+ public:
+  enum class column_type : uint8_t {
+    ekFLOAT64 = 1
+  };
+
+  static constexpr const char kMagic[] = "COSMBIN1";
+  static constexpr const char kExtension[] = ".bin";
+
+  /**
+   * \brief The # of rows per block.
+   */
+  static constexpr const size_t kBlockRows = 1024;
+
+  /**
+   * \param fpath The path of the output file.
+   * \param cols The names of the columns in the file; each row appended must
+   *             contain a value for each column.
+   * \param mode The output mode of the collector writing to the file. If it is
+   *             \ref rmetrics::output_mode::ekAPPEND, rows are appended to an
+   *             existing file with the same columns. Otherwise (or if the
+   *             columns differ) the file is truncated.
+   */
+  binary_sink(const std::string& fpath,
+              const std::vector<std::string>& cols,
+              const rmetrics::output_mode& mode);
+
+  /**
+   * \brief Write out any buffered rows and wait for all writes to complete.
+   */
+  ~binary_sink(void) override;
+
+  binary_sink(const binary_sink&) = delete;
+  binary_sink& operator=(const binary_sink&) = delete;
+
+  /**
+   * \brief Append a row, with one value for each column, in column order.
+   */
+  void row_append(const std::vector<double>& row);
+
+  /**
+   * \brief Hand any partial block of buffered rows to the writer thread, and
+   * wait until everything appended so far has been written.
+   */
+  void flush(void);
+
+  size_t n_cols(void) const { return mc_n_cols; }
+
+  /**
+   * \brief Convert a file written by a \ref binary_sink to .csv.
+   *
+   * \param bin_path The file to convert.
+   * \param csv_path The .csv file to create.
+   * \param separator The .csv column separator.
+   *
+   * \return \c TRUE iff the conversion was successful.
+   */
+  static bool to_csv(const std::string& bin_path,
+                     const std::string& csv_path,
+                     const std::string& separator = ",");
+
+ private:
+  /**
+   * \brief A block of rows, stored column major.
+   */
+  struct block {
+    std::vector<double> values{};
+    size_t n_rows{0};
+  };
+
+  /**
+   * \brief The file header for the specified columns.
+   */
+  static std::string header_build(const std::vector<std::string>& cols);
+
+  /**
+   * \brief Does the file at \p fpath exist and start with \p header?
+   */
+  static bool header_matches(const std::string& fpath,
+                             const std::string& header);
+
+  void writer_main(void);
+  void block_write(const block& b);
+
+  /* clang-format off */
+  const size_t              mc_n_cols;
+
+  std::ofstream             m_ofs;
+  block                     m_fill{};
+  std::deque<block>         m_full{};
+  std::vector<block>        m_free{};
+  bool                      m_writing{false};
+  bool                      m_done{false};
+  std::mutex                m_mtx{};
+  std::condition_variable   m_cv{};
+  std::thread               m_writer{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_BINARY_SINK_HPP_ */
@@ -26,10 +26,12 @@
  ******************************************************************************/
 #include <string>
 #include <list>
-#include <atomic>
+#include <vector>
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/binary_collector.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -47,7 +49,8 @@ NS_START(cosm, metrics, blocks);
  *
  * Metrics are written out at the specified collection interval.
  */
-class transport_metrics_collector final : public rmetrics::base_metrics_collector {
+class transport_metrics_collector final : public rmetrics::base_metrics_collector,
+                                          public cmetrics::binary_collector {
  public:
   /**
    * \param ofname_stem The output file name stem.
@@ -60,51 +63,53 @@ class transport_metrics_collector final : public rmetrics::base_metrics_collecto
   void collect(const rmetrics::base_metrics& metrics) override;
   void reset_after_interval(void) override;
 
-  uint cum_transported(void) const { return m_cum.transported; }
+  uint cum_transported(void) const { return m_cum.transported.load(); }
 
  private:
   /**
-   * \brief Container for holding transported statistics. Must be atomic so
-   * counts are valid in parallel metric collection contexts. Ideally the times
-   * would be atomic \ref rtypes::timestep, but that type does not meet the
-   * std::atomic requirements.
+   * \brief Container for holding transported statistics. Must be sharded so
+   * counts are valid (and uncontended) in parallel metric collection
+   * contexts. Ideally the times would be \ref rtypes::timestep, but that type
+   * is not arithmetic.
    */
   struct stats {
     /**
      * \brief  Total # blocks transported in interval.
      */
-    std::atomic_uint transported{0};
+    cmetrics::sharded_accumulator<uint> transported{};
 
     /**
      * \brief  Total # cube blocks transported in interval.
      */
-    std::atomic_uint cube_transported{0};
+    cmetrics::sharded_accumulator<uint> cube_transported{};
 
     /**
      * \brief  Total # ramp blocks transported in interval.
      */
-    std::atomic_uint ramp_transported{0};
+    cmetrics::sharded_accumulator<uint> ramp_transported{};
 
     /**
      * \brief Total # transporters for transported blocks in interval.
      */
-    std::atomic_uint transporters{0};
+    cmetrics::sharded_accumulator<uint> transporters{};
 
     /**
      * \brief Total amount of time taken for all transported blocks to be
      * transported from original distribution locations to the nest within an
      * interval.
      */
-    std::atomic_uint transport_time{0};
+    cmetrics::sharded_accumulator<uint> transport_time{};
 
     /**
      * \brief Total amount of time between original arena distribution and first
      * pickup for all transported blocks in interval.
      */
-    std::atomic_uint initial_wait_time{0};
+    cmetrics::sharded_accumulator<uint> initial_wait_time{};
   };
 
   std::list<std::string> csv_header_cols(void) const override;
+  std::vector<std::string> binary_cols(void) const override;
+  std::list<std::string> data_cols(void) const;
   boost::optional<std::string> csv_line_build(void) override;
 
   /* clang-format off */
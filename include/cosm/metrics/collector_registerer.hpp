@@ -28,6 +28,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "rcppsw/er/client.hpp"
@@ -41,6 +42,7 @@
 
 #include "cosm/cosm.hpp"
 #include "cosm/metrics/base_metrics_aggregator.hpp"
+#include "cosm/metrics/binary_collector.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -214,6 +216,10 @@ class collector_registerer_impl<std::tuple<Ts...>> : public rer::client<collecto
               init->fpath.c_str(),
               init->output_interval.v(),
               rcppsw::as_underlying(init->mode));
+          binary_output_enable<typename TCollectorWrap::type>(std::get<1>(*it),
+                                                              std::get<2>(*it),
+                                                              init->fpath,
+                                                              init->mode);
         }
       }
     } /* for(it..) */
@@ -303,6 +309,28 @@ class collector_registerer_impl<std::tuple<Ts...>> : public rer::client<collecto
     return std::apply(lambda, std::move(targs));
   }
 
+  /**
+   * \brief If binary output was requested for the collector with the specified
+   * XML name, switch the (just registered) collector to binary output.
+   */
+  template <typename TCollectorType>
+  void binary_output_enable(const std::string& xml_name,
+                            const std::string& scoped_name,
+                            const fs::path& fpath,
+                            rmetrics::output_mode mode) const {
+    if (mc_config->binary.end() == mc_config->binary.find(xml_name)) {
+      return;
+    }
+    if constexpr (std::is_base_of<binary_collector, TCollectorType>::value) {
+      auto* collector = m_agg->template get<TCollectorType>(scoped_name);
+      collector->binary_output_enable(fpath.string(), mode);
+      ER_INFO("Binary output enabled: xml_name='%s'", xml_name.c_str());
+    } else {
+      ER_WARN("Collector '%s' does not support binary output: using .csv",
+              xml_name.c_str());
+    }
+  }
+
   /**
    * \brief Figure out:
    *
@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <map>
+#include <set>
 #include <string>
 
 #include "rcppsw/config/base_config.hpp"
@@ -48,12 +49,16 @@ struct metrics_output_mode_config {
 /**
  * \struct metrics_config
  * \ingroup metrics config
+ *
+ * - \c binary - The XML names of enabled collectors which should write their
+ *   output in binary (see \ref binary_sink) instead of .csv.
  */
 struct metrics_config final : public rconfig::base_config {
   std::string                output_dir{};
   metrics_output_mode_config append{};
   metrics_output_mode_config truncate{};
   metrics_output_mode_config create{};
+  std::set<std::string>      binary{};
 };
 
 NS_END(config, metrics, cosm);
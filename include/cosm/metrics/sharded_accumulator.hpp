@@ -0,0 +1,145 @@
+/**
+ * \file sharded_accumulator.hpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_
+#define INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+#include "cosm/cosm.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+NS_START(detail);
+
+/**
+ * \brief The index of the calling thread among all threads which have ever
+ * called this function, assigned on first call.
+ */
+inline size_t thread_shard_index(void) {
+  static std::atomic<size_t> next{0};
+  thread_local size_t index = next++;
+  return index;
+} /* thread_shard_index() */
+
+NS_END(detail);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class sharded_accumulator
+ * \ingroup metrics
+ *
+ * \brief A counter/sum which can be added to concurrently from many threads
+ * (e.g. by collectors when ARGoS steps controllers in parallel) without losing
+ * updates and without every thread contending for the same cache line.
+ *
+ * Each thread adds to its own cache line padded slot, and the slots are only
+ * merged when the total is read, which collectors do once per output interval
+ * (i.e., in \c csv_line_build()). If there are more threads than slots, threads
+ * share slots, which is still lossless, just not contention free.
+ *
+ * \tparam T The type of the value; must be arithmetic.
+ */
+template <typename T>
+class sharded_accumulator {
+ public:
+  static_assert(std::is_arithmetic<T>::value,
+                "Sharded accumulators only support arithmetic types");
+
+  static constexpr const size_t kShards = 32;
+
+  sharded_accumulator(void) = default;
+
+  /* Not copy constructible/assignable by default */
+  sharded_accumulator(const sharded_accumulator&) = delete;
+  sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+  /**
+   * \brief Add to the value. Can be called concurrently from any # of threads.
+   */
+  void add(T v) {
+    auto& slot = m_shards[detail::thread_shard_index() % kShards].value;
+    if constexpr (std::is_integral<T>::value) {
+      slot.fetch_add(v, std::memory_order_relaxed);
+    } else {
+      /* no fetch_add() for floating point atomics until C++20 */
+      T old = slot.load(std::memory_order_relaxed);
+      while (!slot.compare_exchange_weak(old,
+                                         old + v,
+                                         std::memory_order_relaxed)) {
+      } /* while() */
+    }
+  }
+
+  sharded_accumulator& operator+=(T v) {
+    add(v);
+    return *this;
+  }
+  sharded_accumulator& operator++(void) {
+    add(1);
+    return *this;
+  }
+
+  /**
+   * \brief Get the current value by summing all slots. Not linearizable with
+   * respect to concurrent calls to \ref add(), so should only be called when
+   * no updates are in progress.
+   */
+  T load(void) const {
+    T sum = 0;
+    for (auto& s : m_shards) {
+      sum += s.value.load(std::memory_order_relaxed);
+    } /* for(&s..) */
+    return sum;
+  }
+
+  /**
+   * \brief Reset the value to 0. Should only be called when no updates are in
+   * progress.
+   */
+  void reset(void) {
+    for (auto& s : m_shards) {
+      s.value.store(0, std::memory_order_relaxed);
+    } /* for(&s..) */
+  }
+
+ private:
+  struct alignas(64) shard {
+    std::atomic<T> value{0};
+  };
+
+  /* clang-format off */
+  std::array<shard, kShards> m_shards{};
+  /* clang-format on */
+};
+
+NS_END(metrics, cosm);
+
+#endif /* INCLUDE_COSM_METRICS_SHARDED_ACCUMULATOR_HPP_ */
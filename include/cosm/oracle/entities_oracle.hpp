@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 #include <numeric>
+#include <utility>
 
 #include "cosm/cosm.hpp"
 
@@ -70,6 +71,7 @@ class entities_oracle {
   const knowledge_type& ask(void) const { return m_knowledge; }
 
   void set_knowledge(const knowledge_type& k) { m_knowledge = k; }
+  void set_knowledge(knowledge_type&& k) { m_knowledge = std::move(k); }
 
  private:
   /* clang-format off */
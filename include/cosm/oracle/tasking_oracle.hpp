@@ -26,8 +26,9 @@
  ******************************************************************************/
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 
@@ -61,6 +62,11 @@ NS_START(cosm, oracle);
  * \brief Repository of perfect knowledge about swarm level task
  * allocation. Used to provide an upper bound on the performance of different
  * allocation methods.
+ *
+ * Estimates are stored in a flat table indexed by the vertex ID of each task in
+ * the \ref cta::ds::bi_tdgraph the oracle was constructed with. Queries can be
+ * compiled once into a \ref query_handle via \ref compile(), after which
+ * asking the oracle is a single table lookup.
  */
 class tasking_oracle final : public rer::client<tasking_oracle> {
  public:
@@ -69,17 +75,41 @@ class tasking_oracle final : public rer::client<tasking_oracle> {
 
   using variant_type = boost::variant<cta::time_estimate>;
 
+  /**
+   * \brief A query which has been resolved to a position in the estimate
+   * table. Obtained via \ref compile().
+   */
+  struct query_handle {
+    size_t index;
+  };
+
   tasking_oracle(const coconfig::tasking_oracle_config* config,
                  const cta::ds::bi_tdgraph* graph);
 
   /**
-   * \brief Ask the oracle something.
+   * \brief Resolve a query so that it can be asked repeatedly without any
+   * string processing.
    *
    * \param query The question to ask. Currently oracles:
    *
    * exec_est.\<task name\>
    * interface_est.\<task name\>
    *
+   * \return The handle for the query. Empty if query was ill-formed.
+   */
+  boost::optional<query_handle> compile(const std::string& query) const;
+
+  /**
+   * \brief Ask the oracle something via a handle obtained from \ref
+   * compile().
+   */
+  const cta::time_estimate& ask(const query_handle& handle) const {
+    return m_ests[handle.index];
+  }
+
+  /**
+   * \brief Ask the oracle something, compiling the query each time.
+   *
    * \return The answer to the query. Empty answer if query was ill-formed.
    */
   boost::optional<variant_type> ask(const std::string& query) const;
@@ -102,10 +132,30 @@ class tasking_oracle final : public rer::client<tasking_oracle> {
   void task_finish_cb(const cta::polled_task* task);
 
  private:
+  /**
+   * \brief The # of estimates stored for each task, and the offsets of each
+   * type of estimate within them.
+   */
+  static constexpr const size_t kEstsPerTask = 2;
+  static constexpr const size_t kExecEstOffset = 0;
+  static constexpr const size_t kInterfaceEstOffset = 1;
+
+  /**
+   * \brief Get the index in the estimate table of the first estimate for the
+   * specified task, via its vertex ID. The task can be from the graph of any
+   * robot, as all robots build the same graph, so each task has the same
+   * vertex ID in all of them.
+   */
+  size_t task_index(const cta::polled_task* task) const;
+
+  void ests_update(const cta::polled_task* task, const char* event);
+
   /* clang-format off */
-  const bool                          mc_exec_ests;
-  const bool                          mc_int_ests;
-  std::map<std::string, variant_type> m_map{};
+  const bool                              mc_exec_ests;
+  const bool                              mc_int_ests;
+  /* task name -> vertex ID, only used to compile queries */
+  std::unordered_map<std::string, size_t> m_task_ids{};
+  std::vector<cta::time_estimate>         m_ests{};
   /* clang-format on */
 };
 
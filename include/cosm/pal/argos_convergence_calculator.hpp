@@ -71,9 +71,7 @@ class argos_convergence_calculator : public rer::client<argos_convergence_calcul
   RCPPSW_DECORATE_FUNC(task_dist_entropy_init);
 
  private:
-  std::vector<double> calc_robot_nn(uint n_threads) const;
-  std::vector<rmath::radians> calc_robot_headings2D(uint n_threads) const;
-  std::vector<rmath::vector2d> calc_robot_positions(uint n_threads) const;
+  void calc_snapshot(cconvergence::swarm_snapshot* snapshot, uint n_threads);
 
   /* clang-format off */
   cpal::argos_sm_adaptor* m_sm;
@@ -26,6 +26,7 @@
  ******************************************************************************/
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <argos3/core/simulator/entity/floor_entity.h>
 #include <argos3/core/simulator/loop_functions.h>
@@ -108,6 +109,43 @@ class argos_sm_adaptor : public swarm_manager,
 
   argos::CFloorEntity* floor(void) const { return m_floor; }
 
+  /**
+   * \brief Get a flat vector of all robots of the specified type in the
+   * simulation, which can be indexed (unlike the ARGoS entity map), for use in
+   * \ref iteration_order::ekPARALLEL iteration.
+   *
+   * The vector is cached, and only rebuilt if the # of robots of the
+   * specified type changes, a different type is requested, or \ref
+   * swarm_cache_invalidate() has been called since it was last built. Must not
+   * be called from within a parallel region.
+   *
+   * \tparam TRobotType The type of the robot within the ::argos namespace;
+   *                    entries in the vector can be safely \c static_cast to
+   *                    it.
+   */
+  template<typename TRobotType>
+  const std::vector<argos::CEntity*>& swarm_entities(
+      const std::string& robot_type) const {
+    auto& entities = GetSpace().GetEntitiesByType(robot_type);
+    if (m_swarm_cache_stale || robot_type != m_swarm_cache_type ||
+        entities.size() != m_swarm_cache.size()) {
+      m_swarm_cache.clear();
+      m_swarm_cache.reserve(entities.size());
+      for (auto& [name, robotp] : entities) {
+        m_swarm_cache.push_back(::argos::any_cast<TRobotType*>(robotp));
+      } /* for(...) */
+      m_swarm_cache_type = robot_type;
+      m_swarm_cache_stale = false;
+    }
+    return m_swarm_cache;
+  }
+
+  /**
+   * \brief Mark the cached vector of robots as stale; must be called whenever
+   * robots are added to/removed from the simulation.
+   */
+  void swarm_cache_invalidate(void) { m_swarm_cache_stale = true; }
+
  protected:
 #if (LIBRA_ER >= LIBRA_ER_ALL)
   void ndc_push(void) const {
@@ -140,9 +178,13 @@ class argos_sm_adaptor : public swarm_manager,
   /**
    * \brief The name of the LED medium in ARGoS, for use in destroying caches.
    */
-  std::string            m_led_medium{};
-  argos::CFloorEntity*   m_floor{nullptr};
-  arena_map_variant_type m_arena_map{};
+  std::string                          m_led_medium{};
+  argos::CFloorEntity*                 m_floor{nullptr};
+  arena_map_variant_type               m_arena_map{};
+
+  mutable std::vector<argos::CEntity*> m_swarm_cache{};
+  mutable std::string                  m_swarm_cache_type{};
+  mutable bool                         m_swarm_cache_stale{true};
   /* clang-format on */
 };
 
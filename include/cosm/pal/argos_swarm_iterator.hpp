@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <string>
+#include <type_traits>
 
 #include "cosm/pal/argos_sm_adaptor.hpp"
 #include "cosm/pal/iteration_order.hpp"
@@ -45,10 +46,16 @@ NS_START(cosm, pal);
  * within the ARGoS simulator.
  *
  * The selected action can be specified to be performed in static order
- * (single-threaded execution), or in dynamic order (multi-threaded execution)
- * for speed.
+ * (single-threaded execution), or in dynamic/parallel order (multi-threaded
+ * execution) for speed.
  */
 struct argos_swarm_iterator {
+  /**
+   * \brief The # of consecutive robots each thread processes at a time during
+   * \ref iteration_order::ekPARALLEL iteration.
+   */
+  static constexpr const size_t kPARALLEL_CHUNK = 32;
+
   /**
    * \brief Iterate through controllers using static ordering.
    *
@@ -101,6 +108,77 @@ struct argos_swarm_iterator {
     sm->IterateOverControllableEntities(wrapper);
   }
 
+  /**
+   * \brief Iterate through controllers using parallel ordering (OpenMP
+   * implementation), over the flat vector of robots cached by the \ref
+   * cpal::argos_sm_adaptor.
+   *
+   * \tparam TRobotType The type of the robot within the ::argos namespace of
+   *                    the robots in the swarm.
+   * \tparam TControllerType The type of the controller.
+   * \tparam order The order of iteration: parallel.
+   * \tparam TFunction Type of the lambda callback to use (inferred).
+   *
+   * \param sm Handle to the \ref cpal::argos_sm_adaptor.
+   * \param cb Function to run on each robot in the swarm. Can optionally take
+   *           the index of the robot in [0, swarm size) as a second argument,
+   *           for writing results into pre-sized per-robot storage.
+   * \param robot_type Name associated with the robot type within ARGoS.
+   * \param n_threads How many threads to use.
+   */
+  template <typename TRobotType,
+            typename TControllerType,
+            iteration_order order,
+            typename TFunction,
+            RCPPSW_SFINAE_FUNC(iteration_order::ekPARALLEL == order)>
+  static void controllers(const cpal::argos_sm_adaptor* const sm,
+                          const TFunction& cb,
+                          const std::string& robot_type,
+                          RCSW_UNUSED uint n_threads) {
+    const auto& entities = sm->swarm_entities<TRobotType>(robot_type);
+
+#pragma omp parallel for schedule(static, kPARALLEL_CHUNK) num_threads(n_threads)
+    for (size_t i = 0; i < entities.size(); ++i) {
+      auto* robot = static_cast<TRobotType*>(entities[i]);
+      auto* controller = static_cast<TControllerType*>(
+          &robot->GetControllableEntity().GetController());
+      invoke(cb, controller, i);
+    } /* for(i..) */
+  }
+
+  /**
+   * \brief Compute the sum of a value over all controllers using parallel
+   * ordering (OpenMP implementation), as with \ref controllers().
+   *
+   * \tparam T The (arithmetic) type of the value to sum.
+   *
+   * \param cb Function returning the value for each controller in the swarm.
+   *
+   * \return The sum over all controllers, or 0 if there are none.
+   */
+  template <typename TRobotType,
+            typename TControllerType,
+            typename T,
+            typename TFunction>
+  static T controllers_sum(const cpal::argos_sm_adaptor* const sm,
+                           const TFunction& cb,
+                           const std::string& robot_type,
+                           RCSW_UNUSED uint n_threads) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "Reduction type must be arithmetic");
+    const auto& entities = sm->swarm_entities<TRobotType>(robot_type);
+    T accum = T{0};
+
+#pragma omp parallel for schedule(static, kPARALLEL_CHUNK) reduction(+ : accum) num_threads(n_threads)
+    for (size_t i = 0; i < entities.size(); ++i) {
+      auto* robot = static_cast<TRobotType*>(entities[i]);
+      auto* controller = static_cast<TControllerType*>(
+          &robot->GetControllableEntity().GetController());
+      accum += cb(controller);
+    } /* for(i..) */
+    return accum;
+  }
+
   /**
    * \brief Iterate through robots using static ordering.
    *
@@ -143,6 +221,49 @@ struct argos_swarm_iterator {
                      const TFunction& cb) {
     sm->IterateOverControllableEntities(cb);
   }
+
+  /**
+   * \brief Iterate through robots using parallel ordering (OpenMP
+   * implementation), over the flat vector of robots cached by the \ref
+   * cpal::argos_sm_adaptor.
+   *
+   * \tparam TRobotType The type of the robot within the ::argos namespace of
+   *                    the robots in the swarm.
+   * \tparam order The order of iteration: parallel.
+   * \tparam TFunction Type of the lambda callback (inferred).
+   *
+   * \param sm Handle to the \ref cpal::argos_sm_adaptor.
+   * \param cb Function to run on each robot in the swarm. Can optionally take
+   *           the index of the robot as a second argument.
+   * \param robot_type Name associated with the robot type within ARGoS.
+   * \param n_threads How many threads to use.
+   */
+  template <typename TRobotType,
+            iteration_order order,
+            typename TFunction,
+            RCPPSW_SFINAE_FUNC(iteration_order::ekPARALLEL == order)>
+  static void robots(const cpal::argos_sm_adaptor* const sm,
+                     const TFunction& cb,
+                     const std::string& robot_type,
+                     RCSW_UNUSED uint n_threads) {
+    const auto& entities = sm->swarm_entities<TRobotType>(robot_type);
+
+#pragma omp parallel for schedule(static, kPARALLEL_CHUNK) num_threads(n_threads)
+    for (size_t i = 0; i < entities.size(); ++i) {
+      auto* robot = static_cast<TRobotType*>(entities[i]);
+      invoke(cb, robot, i);
+    } /* for(i..) */
+  }
+
+ private:
+  template <typename TFunction, typename TEntity>
+  static void invoke(const TFunction& cb, TEntity*& entity, size_t i) {
+    if constexpr (std::is_invocable<const TFunction&, TEntity*&, size_t>::value) {
+      cb(entity, i);
+    } else {
+      cb(entity);
+    }
+  }
 };
 
 NS_END(pal, cosm);
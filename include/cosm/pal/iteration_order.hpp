@@ -35,8 +35,22 @@ NS_START(cosm, pal);
  * Type Definitions
  ******************************************************************************/
 enum class iteration_order {
+  /**
+   * \brief Single-threaded iteration over the ARGoS entity map.
+   */
   ekSTATIC,
+
+  /**
+   * \brief Multi-threaded iteration via the ARGoS thread pool.
+   */
   ekDYNAMIC,
+
+  /**
+   * \brief Multi-threaded iteration (OpenMP) in fixed-size chunks over a flat
+   * vector of robots cached by the \ref argos_sm_adaptor, which is only rebuilt
+   * when robots are added/removed.
+   */
+  ekPARALLEL,
 };
 
 NS_END(pal, cosm);
@@ -34,6 +34,7 @@
 #include "cosm/tv/population_dynamics.hpp"
 #include "cosm/cosm.hpp"
 #include "cosm/tv/env_dynamics.hpp"
+#include "cosm/ds/swap_remove_map.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -60,6 +61,11 @@ NS_START(cosm, pal, tv);
  * \brief Adapts \ref ctv::population_dynamics to work within the ARGoS
  * simulator.
  *
+ * Maintains its own indexable sets of the robots in the simulation and of the
+ * robots eligible to malfunction, so that random victim selection and
+ * population counts are O(1), rather than linear in the swarm size via the
+ * ARGoS entity map.
+ *
  * \tparam TControllertype Must be one of the argos 2D/Q3D controllers, BUT can
  * also be a block carrying controller.
  */
@@ -77,8 +83,7 @@ class argos_pd_adaptor : public rer::client<argos_pd_adaptor<TControllerType>>,
   static_assert(is2D<TControllerType>::value || isQ3D<TControllerType>::value,
                 "TControllerType not derived from ARGoS 2D/Q3D adaptor");
   /**
-   * @brief When adding/removing a robot, try this many times to complete the
-   * operation.
+   * @brief When adding a robot, try this many times to find a location for it.
    */
   static constexpr const size_t kMaxOperationAttempts = 1000;
 
@@ -108,12 +113,12 @@ class argos_pd_adaptor : public rer::client<argos_pd_adaptor<TControllerType>>,
   virtual void pre_kill_cleanup(TControllerType*) {}
 
  private:
-  TControllerType* malfunction_victim_locate(size_t total_pop) const;
-  TControllerType* kill_victim_locate(size_t total_pop) const;
+  TControllerType* malfunction_victim_locate(void) const;
+  TControllerType* kill_victim_locate(void) const;
   bool robot_attempt_add(const rtypes::type_uuid& id);
 
   /* clang-format off */
-  const cpal::argos_sm_adaptor* mc_sm;
+  const cpal::argos_sm_adaptor*          mc_sm;
 
   /**
    * \brief The arena dimensions. We already have access to the arena via the
@@ -123,11 +128,21 @@ class argos_pd_adaptor : public rer::client<argos_pd_adaptor<TControllerType>>,
    * figure it out smells bad. So, just pass in the arena dimensions, which is
    * all we need in this class anyway.
    */
-  const rmath::vector2d         mc_arena_dim;
+  const rmath::vector2d                  mc_arena_dim;
+
+  env_dynamics_type*                     m_envd;
+  rmath::rng*                            m_rng;
+  cpal::argos_sm_adaptor*                m_sm;
 
-  env_dynamics_type*            m_envd;
-  rmath::rng*                   m_rng;
-  cpal::argos_sm_adaptor*       m_sm;
+  /**
+   * \brief All robots currently in the simulation.
+   */
+  cds::swap_remove_map<TControllerType*> m_alive{};
+
+  /**
+   * \brief All robots currently in the simulation which are not malfunctioning.
+   */
+  cds::swap_remove_map<TControllerType*> m_functional{};
   /* clang-format on */
 };
 
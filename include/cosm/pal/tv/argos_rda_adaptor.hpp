@@ -24,6 +24,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
+
+#include <argos3/core/simulator/simulator.h>
 #include <argos3/plugins/robots/foot-bot/simulator/footbot_entity.h>
 
 #include "rcppsw/er/client.hpp"
@@ -71,16 +74,18 @@ class argos_rda_adaptor final : public rer::client<argos_rda_adaptor<TController
   const argos_rda_adaptor& operator=(const argos_rda_adaptor&) = delete;
 
   double avg_motion_throttle(void) const override {
-    double accum = 0.0;
-    auto cb = [&](auto& controller) {
-      accum += controller->applied_movement_throttle();
+    auto cb = [&](const auto* controller) {
+      return controller->applied_movement_throttle();
     };
 
-    cpal::argos_swarm_iterator::controllers<argos::CFootBotEntity,
-                                            TControllerType,
-                                            cpal::iteration_order::ekSTATIC>(
-                                                mc_sm, cb, kARGoSRobotType);
-    return accum / mc_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size();
+    double accum = cpal::argos_swarm_iterator::controllers_sum<argos::CFootBotEntity,
+                                                               TControllerType,
+                                                               double>(
+                                                                   mc_sm,
+                                                                   cb,
+                                                                   kARGoSRobotType,
+                                                                   n_threads());
+    return accum / mc_sm->swarm_entities<argos::CFootBotEntity>(kARGoSRobotType).size();
   }
 
   void update(void) override {
@@ -88,19 +93,32 @@ class argos_rda_adaptor final : public rer::client<argos_rda_adaptor<TController
       return;
     }
     rtypes::timestep t(mc_sm->GetSpace().GetSimulationClock());
+
+    /*
+     * Each robot's throttler is only touched by the thread processing that
+     * robot, and the set of throttlers is not modified during iteration, so
+     * this can be done in parallel.
+     */
     auto cb = [&](auto& controller) {
       motion_throttler(controller->entity_id())
       ->toggle(controller->is_carrying_block());
-      motion_throttler(controller->entity_id())->update(t);
     };
 
     cpal::argos_swarm_iterator::controllers<argos::CFootBotEntity,
                                             TControllerType,
-                                            cpal::iteration_order::ekSTATIC>(
-                                                mc_sm, cb, kARGoSRobotType);
+                                            cpal::iteration_order::ekPARALLEL>(
+                                                mc_sm, cb, kARGoSRobotType, n_threads());
+    motion_throttlers_update(t);
   }
 
  private:
+  /**
+   * \brief Use the same # of threads as ARGoS (which can be 0).
+   */
+  static uint n_threads(void) {
+    return std::max(1U, argos::CSimulator::GetInstance().GetNumThreads());
+  }
+
   /* clang-format off */
   const cpal::argos_sm_adaptor* const mc_sm;
   /* clang-format on */
@@ -24,8 +24,10 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <map>
+#include <tuple>
 #include <typeindex>
 
 #include "cosm/hal/actuators/diff_drive_actuator.hpp"
@@ -62,6 +64,10 @@ NS_START(cosm, subsystem);
  *
  * - \ref kin2D::diff_drive
  * - \ref kin2D::governed_diff_drive
+ *
+ * As with \ref base_sensing_subsystem, actuators are passed in as a map
+ * indexed by typeid, but stored in a tuple with one slot per actuator type so
+ * that \ref actuator() is resolved at compile time.
  */
 class actuation_subsystem2D {
  public:
@@ -71,6 +77,11 @@ class actuation_subsystem2D {
                                       kin2D::governed_diff_drive>;
 
   using actuator_map = std::map<std::type_index, variant_type>;
+  using actuator_slots =
+      std::tuple<boost::optional<hal::actuators::led_actuator>,
+                 boost::optional<hal::actuators::wifi_actuator>,
+                 boost::optional<kin2D::diff_drive>,
+                 boost::optional<kin2D::governed_diff_drive>>;
 
   template <typename TActuator>
   static actuator_map::value_type map_entry_create(const TActuator& actuator) {
@@ -80,26 +91,29 @@ class actuation_subsystem2D {
   /**
    * \param actuators Map of handles to actuator devices, indexed by typeid.
    */
-  explicit actuation_subsystem2D(const actuator_map& actuators)
-      : m_actuators(actuators) {}
+  explicit actuation_subsystem2D(const actuator_map& actuators);
 
   /**
    * \brief Reset all actuators, including stopping the robot.
    */
   void reset(void);
 
+  /**
+   * \brief Get the actuator of the specified type. It must have been passed
+   * during construction.
+   */
   template <typename T>
   const T* actuator(void) const {
-    return &boost::get<T>(m_actuators.find(typeid(T))->second);
+    return &*std::get<boost::optional<T>>(m_actuators);
   }
   template <typename T>
   T* actuator(void) {
-    return &boost::get<T>(m_actuators.find(typeid(T))->second);
+    return &*std::get<boost::optional<T>>(m_actuators);
   }
 
  private:
   /* clang-format off */
-  actuator_map m_actuators;
+  actuator_slots m_actuators{};
   /* clang-format on */
 };
 
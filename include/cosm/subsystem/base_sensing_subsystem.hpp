@@ -24,8 +24,10 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <map>
+#include <tuple>
 #include <typeindex>
 
 #include "rcppsw/types/timestep.hpp"
@@ -62,6 +64,11 @@ NS_START(cosm, subsystem);
  * - \ref hal::sensors::battery_sensor
  * - \ref hal::sensors::diff_drive_sensor
  * - \ref hal::sensors::wifi_sensor
+ *
+ * Sensors are passed in as a map indexed by typeid, but are stored in a tuple
+ * with one slot per sensor type, so that looking up a sensor by type via \ref
+ * sensor() is resolved at compile time rather than requiring a map lookup +
+ * variant access on every call.
  */
 class base_sensing_subsystem {
  public:
@@ -73,6 +80,14 @@ class base_sensing_subsystem {
                                       hal::sensors::battery_sensor,
                                       hal::sensors::diff_drive_sensor>;
   using sensor_map = std::map<std::type_index, variant_type>;
+  using sensor_slots =
+      std::tuple<boost::optional<hal::sensors::proximity_sensor>,
+                 boost::optional<hal::sensors::wifi_sensor>,
+                 boost::optional<hal::sensors::colored_blob_camera_sensor>,
+                 boost::optional<hal::sensors::light_sensor>,
+                 boost::optional<hal::sensors::ground_sensor>,
+                 boost::optional<hal::sensors::battery_sensor>,
+                 boost::optional<hal::sensors::diff_drive_sensor>>;
 
   /**
    * \param pos Position sensor.
@@ -80,7 +95,16 @@ class base_sensing_subsystem {
    */
   base_sensing_subsystem(const hal::sensors::position_sensor& pos,
                          const sensor_map& sensors)
-      : m_pos_sensor(pos), m_sensors(sensors) {}
+      : m_pos_sensor(pos) {
+    for (auto& pair : sensors) {
+      boost::apply_visitor(
+          [&](const auto& sensor) {
+            using sensor_type = std::decay_t<decltype(sensor)>;
+            slot<sensor_type>().emplace(sensor);
+          },
+          pair.second);
+    } /* for(&pair..) */
+  }
 
   virtual ~base_sensing_subsystem(void) = default;
 
@@ -101,23 +125,34 @@ class base_sensing_subsystem {
 
   rtypes::timestep tick(void) const { return m_tick; }
 
+  /**
+   * \brief Replace the sensor of the specified type with a new one.
+   *
+   * \return \c TRUE iff a sensor of the specified type was present (and was
+   * therefore replaced).
+   */
   template <typename TSensor>
   bool replace(const TSensor& sensor) {
-    if (m_sensors.end() != m_sensors.find(typeid(sensor))) {
-      m_sensors.erase(m_sensors.find(typeid(sensor)));
-      return m_sensors.insert(map_entry_create(sensor)).second;
+    auto& s = slot<TSensor>();
+    if (!s) {
+      return false;
     }
-    return false;
+    s.emplace(sensor);
+    return true;
   }
 
+  /**
+   * \brief Get the sensor of the specified type. It must have been passed
+   * during construction.
+   */
   template <typename T>
   const T* sensor(void) const {
-    return &boost::get<T>(m_sensors.find(typeid(T))->second);
+    return &*slot<T>();
   }
 
   template <typename T>
   T* sensor(void) {
-    return &boost::get<T>(m_sensors.find(typeid(T))->second);
+    return &*slot<T>();
   }
 
  protected:
@@ -127,11 +162,20 @@ class base_sensing_subsystem {
   }
 
  private:
+  template <typename T>
+  const boost::optional<T>& slot(void) const {
+    return std::get<boost::optional<T>>(m_sensors);
+  }
+  template <typename T>
+  boost::optional<T>& slot(void) {
+    return std::get<boost::optional<T>>(m_sensors);
+  }
+
   /* clang-format off */
   rtypes::timestep              m_tick{0};
   rmath::vector2z               m_dposition{};
   hal::sensors::position_sensor m_pos_sensor;
-  sensor_map                    m_sensors;
+  sensor_slots                  m_sensors{};
   /* clang-format off */
 };
 
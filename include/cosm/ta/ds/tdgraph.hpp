@@ -27,6 +27,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "rcppsw/rcppsw.hpp"
@@ -61,6 +62,10 @@ NS_START(ds);
  * Ideally the graph nodes would be std::unique_ptr<T>, but that does not
  * currently work with the boost libraries, and shared_ptr<T> is not right
  * either, because the graph owns the tasks, so raw pointers are used instead.
+ *
+ * The vertex ID, parent, and depth of each task are recorded in the task as it
+ * is added, and the graph keeps a flat array of all tasks indexed by vertex ID
+ * and a map of task name -> vertex ID, so queries by task or by name are O(1).
  */
 class tdgraph : public rer::client<tdgraph> {
  public:
@@ -162,6 +167,11 @@ class tdgraph : public rer::client<tdgraph> {
 
   size_t n_vertices(void) const { return boost::num_vertices(m_impl); }
 
+  /**
+   * \brief Get all tasks in the graph, indexed by vertex ID.
+   */
+  const std::vector<polled_task*>& tasks(void) const { return m_tasks; }
+
   /**
    * \brief Find the task vertex corresponding to the specified vertex id.
    *
@@ -193,24 +203,31 @@ class tdgraph : public rer::client<tdgraph> {
   using in_edge_iterator = boost::graph_traits<graph_impl>::in_edge_iterator;
 
   /**
-   * \brief Find the vertex descriptor for the vertex, which is what we need to
-   * interact with the graph efficiently.
+   * \brief Find the task with the specified name via the name -> vertex ID
+   * map.
+   *
+   * \return The task, or NULL if no such task.
    */
-  vertex_iterator find_vertex_impl(const polled_task* v) const;
-  vertex_iterator find_vertex_impl(const std::string& v) const;
+  polled_task* find_vertex_impl(const std::string& v) const;
 
   /**
-   * \brief Recursively calculate the depth of a vertex from the root in the
-   * graph.
-   *
-   * \param v The current node along trajectory from desired node up to root.
-   * \param depth The starting depth (should always be 0).
+   * \brief Determine if a task is a vertex in this graph (or a copy of it),
+   * via the vertex ID recorded in the task.
+   */
+  bool contains(const polled_task* v) const RCSW_PURE;
+
+  /**
+   * \brief Add a task to the graph as a child of the specified parent (or as
+   * the root if the parent is NULL), recording its vertex ID, parent, and depth
+   * in the task.
    */
-  uint vertex_depth_impl(const polled_task* v, int depth) const;
+  vertex_desc vertex_add(vertex_type v, polled_task* parent);
 
   /* clang-format off */
-  polled_task*       m_root{nullptr};
-  graph_impl         m_impl{};
+  polled_task*                         m_root{nullptr};
+  graph_impl                           m_impl{};
+  std::vector<polled_task*>            m_tasks{};
+  std::unordered_map<std::string, int> m_ids{};
   /* clang-format on */
 };
 
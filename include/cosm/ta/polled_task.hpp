@@ -39,6 +39,10 @@
  ******************************************************************************/
 NS_START(cosm, ta);
 
+namespace ds {
+class tdgraph;
+} /* namespace ds */
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -48,6 +52,10 @@ NS_START(cosm, ta);
  *
  * \brief Represents a task whose execution can/should be monitored by the user
  * to determine when it has finished.
+ *
+ * Also holds the vertex ID, parent, and depth of the task within the \ref
+ * ds::tdgraph it is added to, which are set by the graph when the task is
+ * added, so that graph queries on the task do not require searching the graph.
  */
 class polled_task : public executable_task, public taskable {
  public:
@@ -64,6 +72,12 @@ class polled_task : public executable_task, public taskable {
 
   taskable* mechanism(void) const { return m_mechanism.get(); }
 
+  /**
+   * \brief Get the vertex ID of the task within the \ref ds::tdgraph it was
+   * added to, or -1 if it has not been added to a graph.
+   */
+  int vertex_id(void) const { return m_vertex_id; }
+
   void task_execute(void) override final { m_mechanism->task_execute(); }
   void task_reset(void) override final { m_mechanism->task_reset(); }
   bool task_running(void) const override { return m_mechanism->task_running(); }
@@ -78,7 +92,14 @@ class polled_task : public executable_task, public taskable {
   void exec_estimate_init(const rmath::rangeu& bounds, rmath::rng* rng);
 
  private:
+  friend class ds::tdgraph;
+
+  /* clang-format off */
+  int                       m_vertex_id{-1};
+  int                       m_vertex_depth{-1};
+  polled_task*              m_vertex_parent{nullptr};
   std::unique_ptr<taskable> m_mechanism;
+  /* clang-format on */
 };
 
 NS_END(ta, cosm);
@@ -30,6 +30,7 @@
 
 #include "rcppsw/metrics/base_metrics_collector.hpp"
 #include "cosm/cosm.hpp"
+#include "cosm/metrics/sharded_accumulator.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -65,31 +66,31 @@ class population_dynamics_metrics_collector final : public rmetrics::base_metric
  private:
   /**
    * \brief Container for holding population dynamics statistics collected from
-   * the swarm. Must be atomic so counts are valid in parallel metric collection
-   * contexts.
+   * the swarm. Counts/sums are sharded and gauges are atomic so that all are
+   * valid in parallel metric collection contexts.
    */
   struct stats {
     /* clang-format off */
-    std::atomic_uint    n_births{0};
-    std::atomic_uint    birth_interval{0};
-    std::atomic<double> birth_mu{0};
-
-    std::atomic_uint    n_deaths{0};
-    std::atomic_uint    death_interval{0};
-    std::atomic<double> death_lambda{0};
-
-    std::atomic_uint    repair_queue_size{0};
-    std::atomic_uint    n_malfunctions{0};
-    std::atomic_uint    malfunction_interval{0};
-    std::atomic<double> malfunction_lambda{0};
-
-    std::atomic_uint    n_repairs{0};
-    std::atomic_uint    repair_interval{0};
-    std::atomic<double> repair_mu{0};
-
-    std::atomic_uint    total_population{0};
-    std::atomic_uint    active_population{0};
-    std::atomic_uint    max_population{0};
+    cmetrics::sharded_accumulator<uint> n_births{};
+    cmetrics::sharded_accumulator<uint> birth_interval{};
+    std::atomic<double>                 birth_mu{0};
+
+    cmetrics::sharded_accumulator<uint> n_deaths{};
+    cmetrics::sharded_accumulator<uint> death_interval{};
+    std::atomic<double>                 death_lambda{0};
+
+    cmetrics::sharded_accumulator<uint> repair_queue_size{};
+    cmetrics::sharded_accumulator<uint> n_malfunctions{};
+    cmetrics::sharded_accumulator<uint> malfunction_interval{};
+    std::atomic<double>                 malfunction_lambda{0};
+
+    cmetrics::sharded_accumulator<uint> n_repairs{};
+    cmetrics::sharded_accumulator<uint> repair_interval{};
+    std::atomic<double>                 repair_mu{0};
+
+    cmetrics::sharded_accumulator<uint> total_population{};
+    cmetrics::sharded_accumulator<uint> active_population{};
+    std::atomic_uint                    max_population{0};
     /* clang-format on */
   };
 
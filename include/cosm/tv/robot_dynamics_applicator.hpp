@@ -25,7 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <boost/optional.hpp>
-#include <map>
+#include <deque>
 
 #include "rcppsw/ds/type_map.hpp"
 #include "rcppsw/er/client.hpp"
@@ -61,10 +61,13 @@ struct robot_dynamics_applicator_config;
  *
  * - Motion variances via throttling
  *
- * This class maintains a map of <id, variance applicator> for each type of
- * variance for each robot, because not all robots experience identical
- * variances (eg variances might only be applied when they are carrying a
- * block).
+ * This class maintains a variance applicator for each type of variance for each
+ * robot, because not all robots experience identical variances (eg variances
+ * might only be applied when they are carrying a block). Robot IDs are small
+ * dense integers, so applicators are stored in place in a deque indexed by ID,
+ * with empty slots for robots which have been unregistered. Growing a deque at
+ * the back does not move existing elements, so handles to applicators remain
+ * valid as other robots are registered.
  *
  * Each type of variance also has a corresponding pure virtual function
  * specifying how information about the state of the variance at the swarm level
@@ -97,7 +100,11 @@ class robot_dynamics_applicator : public rer::client<robot_dynamics_applicator>
 
   const ctv::switchable_tv_generator* motion_throttler(
       const rtypes::type_uuid& id) const {
-    return &m_motion_throttlers.at(id);
+    if (!motion_throttler_registered(id)) {
+      ER_FATAL_SENTINEL("No motion throttler for ID=%d", id.v());
+      return nullptr;
+    }
+    return m_motion_throttlers[static_cast<size_t>(id.v())].get_ptr();
   }
 
   /**
@@ -122,14 +129,30 @@ class robot_dynamics_applicator : public rer::client<robot_dynamics_applicator>
    * \brief Get a reference to the motion throttler for a specific controller.
    */
   ctv::switchable_tv_generator* motion_throttler(const rtypes::type_uuid& id) {
-    return &m_motion_throttlers.at(id);
+    if (!motion_throttler_registered(id)) {
+      ER_FATAL_SENTINEL("No motion throttler for ID=%d", id.v());
+      return nullptr;
+    }
+    return m_motion_throttlers[static_cast<size_t>(id.v())].get_ptr();
   }
 
+  /**
+   * \brief Update the motion throttlers for all registered controllers in a
+   * single pass over the ID-indexed storage. Should be called once per
+   * timestep, after each throttler has been toggled on/off as appropriate.
+   */
+  void motion_throttlers_update(const rtypes::timestep& t);
+
  private:
+  bool motion_throttler_registered(const rtypes::type_uuid& id) const {
+    return id.v() >= 0 &&
+           static_cast<size_t>(id.v()) < m_motion_throttlers.size() &&
+           m_motion_throttlers[static_cast<size_t>(id.v())];
+  }
+
   /* clang-format off */
-  boost::optional<rct::config::waveform_config> mc_motion_throttle_config{};
-  std::map<rtypes::type_uuid,
-           ctv::switchable_tv_generator>        m_motion_throttlers{};
+  boost::optional<rct::config::waveform_config>             mc_motion_throttle_config{};
+  std::deque<boost::optional<ctv::switchable_tv_generator>> m_motion_throttlers{};
   /* clang-format on */
 };
 
@@ -29,6 +29,9 @@
 #include <memory>
 #include <mutex>
 #include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "rcppsw/control/periodic_waveform.hpp"
 #include "rcppsw/control/waveform_generator.hpp"
@@ -55,6 +58,11 @@ NS_START(cosm, tv);
  *
  * Does not do much more than provide the penalty list, and functions for
  * manipulating it to derived classes.
+ *
+ * Penalties are kept in the order they were added, and are also indexed by
+ * controller and by finish time, so that finding/removing a robot's penalty and
+ * checking for conflicting finish times are constant time, rather than linear
+ * in the # of robots currently serving penalties.
  */
 class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
  public:
@@ -106,7 +114,12 @@ class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
    */
   void penalty_remove(const temporal_penalty& victim, bool lock = true) {
     maybe_lock(lock);
-    m_penalty_list.remove(victim);
+    auto it = m_controller_index.find(victim.controller());
+    if (m_controller_index.end() != it) {
+      m_finish_times.erase(finish_time(*it->second));
+      m_penalty_list.erase(it->second);
+      m_controller_index.erase(it);
+    }
     maybe_unlock(lock);
   }
 
@@ -134,13 +147,11 @@ class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
   const_iterator_type penalty_find(const controller::base_controller& controller,
                                    bool lock = true) const {
     maybe_lock(lock);
-    auto it = std::find_if(m_penalty_list.begin(),
-                           m_penalty_list.end(),
-                           [&](const temporal_penalty& p) {
-                             return p.controller() == &controller;
-                           });
+    auto it = m_controller_index.find(&controller);
+    auto ret = (m_controller_index.end() == it) ? m_penalty_list.end()
+                                                : const_iterator_type(it->second);
     maybe_unlock(lock);
-    return it;
+    return ret;
   }
   /**
    * \brief If \c TRUE, then the specified robot is currently serving a cache
@@ -217,8 +228,24 @@ class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
      * all robots to always obey cache pickup policies. See COSM#625.
      */
     std::scoped_lock lock(m_list_mtx);
+
+    /*
+     * A robot can only serve one penalty at a time. Adding a second one would
+     * orphan the first in the list, so it is left in place and its duration
+     * returned instead.
+     */
+    auto [index_it, inserted] = m_controller_index.emplace(controller,
+                                                           m_penalty_list.end());
+    ER_ASSERT(inserted,
+              "Robot%d already serving a penalty",
+              controller->entity_id().v());
+    if (!inserted) {
+      return index_it->second->penalty();
+    }
     auto duration = penalty_finish_uniqueify(start, orig_duration);
     m_penalty_list.push_back(temporal_penalty(controller, id, duration, start));
+    index_it->second = std::prev(m_penalty_list.end());
+    m_finish_times.insert(finish_time(m_penalty_list.back()));
     return duration;
   }
 
@@ -240,15 +267,16 @@ class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
    */
   rtypes::timestep penalty_finish_uniqueify(const rtypes::timestep& start,
                                             rtypes::timestep duration) const {
-    for (auto it = m_penalty_list.begin(); it != m_penalty_list.end(); ++it) {
-      if (it->start_time() + it->penalty() == start + duration) {
-        duration += 1;
-        it = m_penalty_list.begin();
-      }
-    } /* for(i..) */
+    while (m_finish_times.count((start + duration).v())) {
+      duration += 1;
+    } /* while() */
     return duration;
   }
 
+  static size_t finish_time(const temporal_penalty& p) {
+    return (p.start_time() + p.penalty()).v();
+  }
+
   /**
    * \brief *Possibly* lock the penalty list mutex.
    *
@@ -279,6 +307,19 @@ class temporal_penalty_handler : public rer::client<temporal_penalty_handler> {
   const std::string              mc_name;
 
   std::list<temporal_penalty>    m_penalty_list{};
+
+  /**
+   * \brief The position of the penalty each robot is serving in the penalty
+   * list (list iterators are stable across insertions/removals).
+   */
+  std::unordered_map<const controller::base_controller*,
+                     std::list<temporal_penalty>::iterator> m_controller_index{};
+
+  /**
+   * \brief The finish times of all penalties currently in the list, which are
+   * unique.
+   */
+  std::unordered_set<size_t>     m_finish_times{};
   mutable std::mutex             m_list_mtx{};
   std::unique_ptr<rct::waveform> m_waveform;
   /* clang-format on */
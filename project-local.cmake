@@ -4,7 +4,7 @@
 set(COSM_HAL_TARGET "NONE" CACHE STRING "Specify the Hardware Abstraction Layer (HAL) target")
 define_property(CACHED_VARIABLE PROPERTY "COSM_HAL_TARGET"
 		BRIEF_DOCS "Specify the Hardware Abstraction Layer (HAL) target"
-		FULL_DOCS "Must be exactly one of: [argos-footbot,lego-ev3]"
+		FULL_DOCS "Must be exactly one of: [argos-footbot,lego-ev3,native-sim]"
                 )
 
 # Conditionally compile/link Qt visualizations.
@@ -61,6 +61,37 @@ if (NOT ${COSM_WITH_VIS})
     ${${target}_SRC_PATH}/vis/task_visualizer.cpp)
 endif()
 
+# The built-in kinematic simulator is only needed for the native-sim target.
+#
+# Without ARGoS, the ARGoS platform adaptors are not usable, and neither is
+# anything built on ARGoS entities (the nest and caches are lit by ARGoS
+# lights): the arena map and the operations on it, block distribution, and the
+# foraging LOS/oracle/penalty handling which use the arena map.
+if ("${LIBRA_BUILD_FOR}" MATCHES "NATIVE")
+  file(GLOB_RECURSE ${target}_PAL_SRC ${${target}_SRC_PATH}/pal/*.cpp)
+  file(GLOB ${target}_ARENA_OPS_SRC ${${target}_SRC_PATH}/arena/operations/*.cpp)
+  file(GLOB ${target}_BLOCK_DIST_SRC
+    ${${target}_SRC_PATH}/foraging/block_dist/*_distributor.cpp)
+  list(REMOVE_ITEM ${target}_SRC
+    ${${target}_PAL_SRC}
+    ${${target}_ARENA_OPS_SRC}
+    ${${target}_BLOCK_DIST_SRC}
+    ${${target}_SRC_PATH}/arena/base_arena_map.cpp
+    ${${target}_SRC_PATH}/arena/caching_arena_map.cpp
+    ${${target}_SRC_PATH}/arena/ds/cache_vector.cpp
+    ${${target}_SRC_PATH}/arena/repr/arena_cache.cpp
+    ${${target}_SRC_PATH}/foraging/block_dist/dispatcher.cpp
+    ${${target}_SRC_PATH}/foraging/oracle/foraging_oracle.cpp
+    ${${target}_SRC_PATH}/foraging/repr/foraging_los.cpp
+    ${${target}_SRC_PATH}/foraging/tv/penalty_id_calculator.cpp
+    ${${target}_SRC_PATH}/foraging/utils/utils.cpp
+    ${${target}_SRC_PATH}/repr/nest.cpp)
+else()
+  list(REMOVE_ITEM ${target}_SRC
+    ${${target}_SRC_PATH}/hal/native_sim/world.cpp
+    ${${target}_SRC_PATH}/hal/native_sim/devices.cpp)
+endif()
+
 ################################################################################
 # Includes                                                                     #
 ################################################################################
@@ -74,9 +105,12 @@ elseif("${LIBRA_BUILD_FOR}" MATCHES "ARGOS")
 elseif("${LIBRA_BUILD_FOR}" MATCHES "EV3")
   message(STATUS "Building for EV3")
     set(COSM_HAL_TARGET "ev3")
+elseif("${LIBRA_BUILD_FOR}" MATCHES "NATIVE")
+  message(STATUS "Building for native simulation")
+  set(COSM_HAL_TARGET "native-sim")
 else()
   message(FATAL_ERROR
-    "Unknown build target '${LIBRA_BUILD_FOR}'. Must be: [MSI,ARGOS,EV3]")
+    "Unknown build target '${LIBRA_BUILD_FOR}'. Must be: [MSI,ARGOS,EV3,NATIVE]")
 endif()
 
 set(${target}_INCLUDE_DIRS
@@ -121,8 +155,10 @@ if (NOT TARGET ${target})
     target_compile_definitions(${target} PUBLIC COSM_HAL_TARGET=HAL_TARGET_ARGOS_FOOTBOT)
   elseif("${COSM_HAL_TARGET}" MATCHES "lego-ev3")
     target_compile_definitions(${target} PUBLIC COSM_HAL_TARGET=HAL_TARGET_LEGO_EV3)
+  elseif("${COSM_HAL_TARGET}" MATCHES "native-sim")
+    target_compile_definitions(${target} PUBLIC COSM_HAL_TARGET=HAL_TARGET_NATIVE_SIM)
   else()
-    message(FATAL_ERROR "Bad HAL Target ${COSM_HAL_TARGET}. Must be [lego-ev3,argos-footbot]")
+    message(FATAL_ERROR "Bad HAL Target ${COSM_HAL_TARGET}. Must be [lego-ev3,argos-footbot,native-sim]")
   endif()
 endif()
 
@@ -134,6 +170,24 @@ if ("${LIBRA_BUILD_FOR}" MATCHES "ARGOS")
     target_compile_definitions(${target} PUBLIC COSM_WITH_ARGOS_ROBOT_LEDS)
   endif()
 endif()
+################################################################################
+# Benchmarks                                                                   #
+################################################################################
+# Each tests/*-bench.cpp is a standalone program linked against the library
+# which prints its timings to stdout. They are not part of 'all' or the unit
+# tests; build them with 'make benchmarks' and run them by hand.
+file(GLOB ${target}_BENCH_SRC ${CMAKE_CURRENT_SOURCE_DIR}/tests/*-bench.cpp)
+if (NOT TARGET benchmarks)
+  add_custom_target(benchmarks)
+endif()
+foreach(bench ${${target}_BENCH_SRC})
+  get_filename_component(bench_name ${bench} NAME_WE)
+  add_executable(${bench_name} EXCLUDE_FROM_ALL ${bench})
+  target_link_libraries(${bench_name} ${target})
+  target_include_directories(${bench_name} SYSTEM PRIVATE "${${target}_SYS_INCLUDE_DIRS}")
+  add_dependencies(benchmarks ${bench_name})
+endforeach()
+
 ################################################################################
 # Exports                                                                      #
 ################################################################################
@@ -22,6 +22,9 @@
  ******************************************************************************/
 #include "cosm/arena/base_arena_map.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include <argos3/plugins/simulator/media/led_medium.h>
 
 #include "cosm/ds/cell2D.hpp"
@@ -73,6 +76,8 @@ base_arena_map<TBlockType>::base_arena_map(const caconfig::arena_map_config* con
           grid_resolution().v());
   for (auto& b : m_blockso) {
     m_blocksno.push_back(b.get());
+    m_max_block_dims.x(std::max(m_max_block_dims.x(), b->dims2D().x()));
+    m_max_block_dims.y(std::max(m_max_block_dims.y(), b->dims2D().y()));
   } /* for(&b..) */
 }
 
@@ -86,7 +91,7 @@ bool base_arena_map<TBlockType>::initialize(pal::argos_sm_adaptor* sm,
     sm->AddEntity(*l);
   } /* for(&l..) */
 
-  return m_block_dispatcher.initialize(rng);
+  return m_block_dispatcher.initialize(rng, m_max_block_dims);
 } /* initialize() */
 
 template<class TBlockType>
@@ -94,26 +99,61 @@ rtypes::type_uuid base_arena_map<TBlockType>::robot_on_block(
     const rmath::vector2d& pos,
     const rtypes::type_uuid& ent_id) const {
   /*
-   * If the robot actually is on the block they think they are, we can short
-   * circuit what may be an expensive linear search. ent_id MIGHT be for a
-   * non-block that a robot has acuired, which may cause out of bounds indexing
-   * into the blocks vector, so we have to check for that.
+   * Free blocks are always referenced by their host cell, so only the cells
+   * close enough to the robot for the extent of a block hosted there to contain
+   * it need to be checked. We do not look up the block the robot thinks it is
+   * on directly, as it may be being dropped/distributed elsewhere in the arena;
+   * blocks referenced by cells in the tiles we hold cannot be.
+   *
+   * If the robot is on more than one block, the one it thinks it is on is
+   * preferred.
    */
-  if (ent_id != rtypes::constants::kNoUUID &&
-      static_cast<size_t>(ent_id.v()) < m_blockso.size() &&
-      m_blockso[ent_id.v()]->contains_point2D(pos)) {
-    return ent_id;
-  }
-
-  /* General case: linear scan */
-  for (auto& b : m_blockso) {
-    if (b->contains_point2D(pos)) {
-      return b->id();
-    }
-  } /* for(&b..) */
-  return rtypes::constants::kNoUUID;
+  auto bounds = host_cell_search_bounds(pos, m_max_block_dims);
+  rtypes::type_uuid ret = rtypes::constants::kNoUUID;
+  decoratee().region_lock(bounds.first, bounds.second);
+  for (size_t i = bounds.first.x(); i <= bounds.second.x(); ++i) {
+    for (size_t j = bounds.first.y(); j <= bounds.second.y(); ++j) {
+      const cds::cell2D& cell =
+          decoratee().template access<cds::arena_grid::kCell>(i, j);
+      if (!cell.state_has_block() ||
+          (rtypes::constants::kNoUUID != ret && ent_id == ret)) {
+        continue;
+      }
+      auto* block = dynamic_cast<const TBlockType*>(cell.entity());
+      if (nullptr != block && block->contains_point2D(pos) &&
+          (rtypes::constants::kNoUUID == ret || ent_id == block->id())) {
+        ret = block->id();
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  decoratee().region_unlock(bounds.first, bounds.second);
+  return ret;
 } /* robot_on_block() */
 
+template<class TBlockType>
+std::pair<rmath::vector2z, rmath::vector2z> base_arena_map<TBlockType>::host_cell_search_bounds(
+    const rmath::vector2d& pos,
+    const rmath::vector2d& dims) const {
+  /*
+   * Entities are centered on (approximately) the origin of their host cell, so
+   * pad the window by a cell on each side to account for rounding during
+   * discretization.
+   */
+  double res = grid_resolution().v();
+  auto lb = [&](double coord, double dim) {
+    return static_cast<size_t>(
+        std::max(0.0, std::floor((coord - dim / 2.0) / res) - 1.0));
+  };
+  auto ub = [&](double coord, double dim, size_t dsize) {
+    return std::min(dsize - 1,
+                    static_cast<size_t>(std::max(
+                        0.0, std::ceil((coord + dim / 2.0) / res) + 1.0)));
+  };
+  return {rmath::vector2z(lb(pos.x(), dims.x()), lb(pos.y(), dims.y())),
+          rmath::vector2z(ub(pos.x(), dims.x(), xdsize()),
+                          ub(pos.y(), dims.y(), ydsize()))};
+} /* host_cell_search_bounds() */
+
 template<class TBlockType>
 bool base_arena_map<TBlockType>::distribute_single_block(TBlockType* block,
                                                          const arena_map_locking& locking) {
@@ -129,7 +169,8 @@ bool base_arena_map<TBlockType>::distribute_single_block(TBlockType* block,
   auto precalc = block_dist_precalc(block);
 
   /* do the distribution */
-  bool ret = m_block_dispatcher.distribute_block(precalc.dist_ent,
+  bool ret = nullptr != precalc.dist_ent &&
+             m_block_dispatcher.distribute_block(precalc.dist_ent,
                                                  precalc.avoid_ents);
 
   /* unlock the arena map */
@@ -142,6 +183,9 @@ void base_arena_map<TBlockType>::distribute_all_blocks(void) {
   // Reset all the cells to clear old references to blocks
   decoratee().reset();
 
+  /* clear old references to blocks in clusters too */
+  m_block_dispatcher.distributor()->clusters_recalc();
+
   /* calculate the entities to avoid during distribution */
   auto precalc = block_dist_precalc(nullptr);
 
@@ -182,37 +226,37 @@ template<class TBlockType>
 typename base_arena_map<TBlockType>::block_dist_precalc_type base_arena_map<TBlockType>::block_dist_precalc(
     const TBlockType* block) {
 
-  /* Entities that need to be avoided during block distribution are:
+  /*
+   * Entities that need to be avoided during block distribution are:
    *
-   * - All existing blocks
    * - Nest
+   *
+   * Blocks do not need to be added to the list of entities to avoid: the
+   * distributors check for overlap with blocks via the arena grid cells near
+   * each candidate placement, and the grid is kept up to date by every block
+   * pickup/drop/distribution. This keeps the cost of computing the list (and
+   * therefore how long the arena map locks are held) independent of the # of
+   * blocks.
    */
   block_dist_precalc_type ret;
 
-  /*
-   * If this is the initial block distribution (or distribution after reset),
-   * then we can skip this, because wherever blocks are now is invalid, AND
-   * after a given block is distributed, it is added to the list of entities to
-   * be avoided.
-   */
   if (nullptr != block) {
-    for (auto& b : m_blockso) {
-      /*
-       * Cannot compare via dloccmp() because the block being distributed is
-       * currently out of sight, just like any other blocks currently carried by
-       * robots, resulting in the wrong block being distributed.
-       */
-      if (!(block == b.get())) {
-        ret.avoid_ents.push_back(b.get());
-      } else {
-        ret.dist_ent = b.get();
-      }
-    } /* for(&b..) */
-    ER_ASSERT(
-        ret.dist_ent->id() == block->id(),
-        "ID of block to distribute != ID of block in block vector: %d != %d",
-        block->id().v(),
-        ret.dist_ent->id().v());
+    /*
+     * Cannot compare via dloccmp() because the block being distributed is
+     * currently out of sight, just like any other blocks currently carried by
+     * robots, resulting in the wrong block being distributed. Block IDs are
+     * their indices in the blocks vector, so no searching is needed. If the
+     * block is not there, the distribution entity is left as NULL, and the
+     * distribution fails.
+     */
+    auto idx = static_cast<size_t>(block->id().v());
+    if (block->id().v() >= 0 && idx < m_blockso.size() &&
+        block == m_blockso[idx].get()) {
+      ret.dist_ent = m_blockso[idx].get();
+    } else {
+      ER_ERR("Block%d to distribute not found in block vector",
+             block->id().v());
+    }
   }
 
   ret.avoid_ents.push_back(&m_nest);
@@ -22,9 +22,12 @@
  ******************************************************************************/
 #include "cosm/arena/caching_arena_map.hpp"
 
+#include <algorithm>
+
 #include <argos3/plugins/simulator/media/led_medium.h>
 
 #include "cosm/arena/repr/arena_cache.hpp"
+#include "cosm/ds/cell2D.hpp"
 #include "cosm/arena/repr/light_type_index.hpp"
 #include "cosm/pal/argos_sm_adaptor.hpp"
 #include "cosm/repr/base_block2D.hpp"
@@ -49,20 +52,27 @@ void caching_arena_map::caches_add(const cads::acache_vectoro& caches,
   auto& medium =
       sm->GetSimulator().GetMedium<argos::CLEDMedium>(sm->led_medium());
 
-  /*
-   * Add all lights of caches to the arena. Cache lights are added directly to
-   * the LED medium, which is different than what is rendered to the screen, so
-   * they actually are invisible.
-   */
   for (auto& c : caches) {
+    /*
+     * A cache whose ID is already indexed must not be added again, or the
+     * index would refer to only one of the two copies.
+     */
+    if (!m_cache_index.emplace(c->id().v(), m_cacheso.size()).second) {
+      ER_WARN("Cache%d already present: not added", c->id().v());
+      continue;
+    }
+    /*
+     * Add the cache's light to the arena. Cache lights are added directly to
+     * the LED medium, which is different than what is rendered to the screen,
+     * so they actually are invisible.
+     */
     medium.AddEntity(*c->light());
-  } /* for(&c..) */
-
-  for (auto& c : caches) {
+    m_cacheso.push_back(c);
     m_cachesno.push_back(c.get());
+    m_max_cache_dims.x(std::max(m_max_cache_dims.x(), c->dims2D().x()));
+    m_max_cache_dims.y(std::max(m_max_cache_dims.y(), c->dims2D().y()));
   } /* for(&c..) */
 
-  m_cacheso.insert(m_cacheso.end(), caches.begin(), caches.end());
   ER_INFO("Add %zu created caches, total=%zu", caches.size(), m_cacheso.size());
 } /* caches_add() */
 
@@ -86,23 +96,39 @@ rtypes::type_uuid caching_arena_map::robot_on_cache(
     const rtypes::type_uuid& ent_id) const {
   /*
    * If the robot actually is on the cache they think they are, we can short
-   * circuit what may be an expensive linear search. ent_id MIGHT be for a block
-   * we have acquired, which may cause out of bounds indexing into the caches
-   * vector, so we have to check for that.
+   * circuit searching the cells near the robot. ent_id MIGHT be for a block we
+   * have acquired, or a cache which has since been depleted, so we have to
+   * check for that.
    */
-  if (ent_id != rtypes::constants::kNoUUID &&
-      static_cast<size_t>(ent_id.v()) < m_cacheso.size() &&
-      m_cacheso[ent_id.v()]->contains_point2D(pos)) {
-    return ent_id;
+  if (ent_id != rtypes::constants::kNoUUID) {
+    auto it = m_cache_index.find(ent_id.v());
+    if (m_cache_index.end() != it &&
+        m_cacheso[it->second]->contains_point2D(pos)) {
+      return ent_id;
+    }
   }
 
-  /* General case: linear scan */
-  for (auto& c : m_cacheso) {
-    if (c->contains_point2D(pos)) {
-      return c->id();
-    }
-  } /* for(&c..) */
-  return rtypes::constants::kNoUUID;
+  /*
+   * General case: search the cells near the robot for the host cell of a cache
+   * whose extent contains the robot.
+   */
+  auto bounds = host_cell_search_bounds(pos, m_max_cache_dims);
+  rtypes::type_uuid ret = rtypes::constants::kNoUUID;
+  decoratee().region_lock(bounds.first, bounds.second);
+  for (size_t i = bounds.first.x(); i <= bounds.second.x(); ++i) {
+    for (size_t j = bounds.first.y(); j <= bounds.second.y(); ++j) {
+      const cds::cell2D& cell = access<cds::arena_grid::kCell>(i, j);
+      if (!cell.state_has_cache() || rtypes::constants::kNoUUID != ret) {
+        continue;
+      }
+      auto* cache = cell.cache();
+      if (nullptr != cache && cache->contains_point2D(pos)) {
+        ret = cache->id();
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  decoratee().region_unlock(bounds.first, bounds.second);
+  return ret;
 } /* robot_on_cache() */
 
 void caching_arena_map::cache_remove(repr::arena_cache* victim,
@@ -120,26 +146,31 @@ void caching_arena_map::cache_remove(repr::arena_cache* victim,
   size_t before = m_cacheso.size();
   RCSW_UNUSED rtypes::type_uuid id = victim->id();
 
-  /*
-   * Lookup the victim in the cache vector, since the i-th cache is not
-   * guaranteed to be in position i in the vector.
-   */
-  auto victim_it =
-      std::find_if(m_cacheso.begin(), m_cacheso.end(), [&](const auto& c) {
-        return c.get() == victim;
-      });
+  auto victim_it = m_cache_index.find(victim->id().v());
+  ER_ASSERT(m_cache_index.end() != victim_it &&
+                m_cachesno[victim_it->second] == victim,
+            "Cache%d not found",
+            id.v());
+  size_t pos = victim_it->second;
+  m_cache_index.erase(victim_it);
+
   /*
    * Add cache to zombie vector to ensure accurate metric collection THIS
    * timestep about caches.
    */
-  m_zombie_caches.push_back(*victim_it);
+  m_zombie_caches.push_back(std::move(m_cacheso[pos]));
 
   /*
-   * Update owned and access cache vectors, verifying that the removal worked as
-   * expected.
+   * Update owned and access cache vectors by moving the last cache into the
+   * victim's position, verifying that the removal worked as expected.
    */
-  m_cachesno.erase(std::remove(m_cachesno.begin(), m_cachesno.end(), victim));
-  m_cacheso.erase(std::remove(m_cacheso.begin(), m_cacheso.end(), *victim_it));
+  if (pos != before - 1) {
+    m_cacheso[pos] = std::move(m_cacheso.back());
+    m_cachesno[pos] = m_cachesno.back();
+    m_cache_index[m_cacheso[pos]->id().v()] = pos;
+  }
+  m_cacheso.pop_back();
+  m_cachesno.pop_back();
   ER_ASSERT(m_cachesno.size() == before - 1,
             "Cache%d not removed from access vector",
             id.v());
@@ -167,11 +198,17 @@ caching_arena_map::block_dist_precalc_type caching_arena_map::block_dist_precalc
    * Additional entities that need to be avoided during block distribution are:
    *
    * - All existing caches
+   *
+   * Like blocks, caches are referenced by the grid cells in their extent and
+   * so are normally avoided by the distributors without being in the list.
+   * During initial distribution the grid has just been reset, so they need to
+   * be avoided explicitly.
    */
-  cds::const_entity_vector entities;
-  for (auto& cache : m_cacheso) {
-    ret.avoid_ents.push_back(cache.get());
-  } /* for(&cache..) */
+  if (nullptr == block) {
+    for (auto& cache : m_cacheso) {
+      ret.avoid_ents.push_back(cache.get());
+    } /* for(&cache..) */
+  }
   return ret;
 } /* block_dist_precalc() */
 
@@ -95,8 +95,18 @@ void cache_block_drop::visit(caching_arena_map& map) {
    * later) this timestep, and caches by definition have a unique location, AND
    * if another robot has just caused a block re-distribution, that operation
    * avoids caches.
+   *
+   * Tiled operations only read cells in the tiles they hold, so if tiled
+   * locking was requested we lock the tile containing the host cell.
    */
+  bool tiled = !!(mc_locking & arena_map_locking::ekGRID_TILED);
+  if (tiled) {
+    map.maybe_lock_cell(cell2D_op::coord(), mc_locking);
+  }
   visit(map.access<arena_grid::kCell>(cell2D_op::coord()));
+  if (tiled) {
+    map.maybe_unlock_cell(cell2D_op::coord(), mc_locking);
+  }
 
   ER_INFO("arena_map: fb%d dropped block%d in cache%d,total=[%s] (%zu)",
           robot_id.v(),
@@ -59,6 +59,16 @@ static bool block_drop_overlap_with_nest(const crepr::base_block3D* block,
                                          const crepr::nest& nest,
                                          const rmath::vector2d& drop_loc);
 
+/**
+ * \brief Does \p locking specify that only the tile of the grid containing the
+ * drop cell (and the block mutex shared) should be held, rather than the whole
+ * grid (and the block mutex exclusively)?
+ */
+static bool tiles_only(const arena_map_locking& locking) {
+  return !!(locking & arena_map_locking::ekGRID_TILED) &&
+         !(locking & arena_map_locking::ekGRID_HELD);
+}
+
 template<typename TBlockType>
 static bool block_drop_loc_conflict(const base_arena_map<TBlockType>& map,
                                     const TBlockType* block,
@@ -116,17 +126,71 @@ void free_block_drop<TBlockType>::visit(crepr::base_block3D& block) {
   block.dloc(rmath::vector3z(cell2D_op::coord()));
 } /* visit() */
 
+template<typename TBlockType>
+template<typename TMapType, typename TDistBlockType>
+void free_block_drop<TBlockType>::redistribute(TMapType& map,
+                                               TDistBlockType* block) {
+  if (!tiles_only(mc_locking)) {
+    map.distribute_single_block(block, arena_map_locking::ekALL_HELD);
+    return;
+  }
+  /*
+   * Block distribution can pick any cell in the arena, so we have to trade the
+   * tile and shared block mutex we hold for the whole grid and the exclusive
+   * block mutex, and then take them back so that the unlock in visit() is
+   * balanced. Both must be released first, as mutexes are always acquired in
+   * the order caches, blocks, grid.
+   */
+  map.maybe_unlock_cell(cell2D_op::coord(), mc_locking);
+  map.maybe_unlock_blocks(mc_locking);
+  map.distribute_single_block(block,
+                              arena_map_locking::ekCACHES_HELD |
+                              (mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  map.maybe_lock_blocks(mc_locking);
+  map.maybe_lock_cell(cell2D_op::coord(), mc_locking);
+} /* redistribute() */
+
+template<typename TBlockType>
+void free_block_drop<TBlockType>::cache_drop(caching_arena_map& map,
+                                             carepr::arena_cache* cache) {
+  if (!tiles_only(mc_locking)) {
+    cache_block_drop_visitor op(boost::get<crepr::base_block2D*>(mc_block),
+                                cache,
+                                mc_resolution,
+                                arena_map_locking::ekALL_HELD);
+    op.visit(map);
+    return;
+  }
+  /*
+   * The cache host cell may be in a different tile than the drop cell, and the
+   * cache drop needs the block mutex exclusively, so we release our tile and
+   * shared block mutex and let the cache drop take what it needs, as for
+   * \ref redistribute().
+   */
+  map.maybe_unlock_cell(cell2D_op::coord(), mc_locking);
+  map.maybe_unlock_blocks(mc_locking);
+  cache_block_drop_visitor op(boost::get<crepr::base_block2D*>(mc_block),
+                              cache,
+                              mc_resolution,
+                              arena_map_locking::ekCACHES_HELD |
+                              arena_map_locking::ekGRID_TILED |
+                              (mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  op.visit(map);
+  map.maybe_lock_blocks(mc_locking);
+  map.maybe_lock_cell(cell2D_op::coord(), mc_locking);
+} /* cache_drop() */
+
 template<typename TBlockType>
 void free_block_drop<TBlockType>::visit(base_arena_map<TBlockType>& map) {
-  map.maybe_lock(map.block_mtx(),
-                 !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  map.maybe_lock_blocks(mc_locking);
 
   /*
    * We might be modifying this cell--don't want block distribution in ANOTHER
-   * thread to pick this cell for distribution.
+   * thread to pick this cell for distribution. If tiled locking was requested,
+   * we only lock the tile containing the cell (and the block mutex shared), so
+   * drops elsewhere in the arena can proceed in parallel.
    */
-  map.maybe_lock(map.grid_mtx(),
-                 !(mc_locking & arena_map_locking::ekGRID_HELD));
+  map.maybe_lock_cell(cell2D_op::coord(), mc_locking);
 
   auto rloc = rmath::zvec2dvec(cell2D_op::coord(), mc_resolution.v());
   bool conflict = block_drop_loc_conflict(map,
@@ -142,22 +206,20 @@ void free_block_drop<TBlockType>::visit(base_arena_map<TBlockType>& map) {
    * cache.
    */
   if (cell.state_has_block() || conflict) {
-    map.distribute_single_block(boost::get<TBlockType*>(mc_block),
-                                arena_map_locking::ekALL_HELD);
+    redistribute(map, boost::get<TBlockType*>(mc_block));
   } else {
     /*
      * Cell does not have a block/cache on it, so it is safe to drop the block
      * on it and change the cell state.
      *
-     * Holding arena map grid lock, block lock if locking enabled.
+     * Holding (at least) the tile of the arena map grid containing the cell.
      */
     visit(cell);
+    map.clusters_update_after_drop(boost::get<TBlockType*>(mc_block));
   }
 
-  map.maybe_unlock(map.grid_mtx(),
-                   !(mc_locking & arena_map_locking::ekGRID_HELD));
-  map.maybe_unlock(map.block_mtx(),
-                   !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  map.maybe_unlock_cell(cell2D_op::coord(), mc_locking);
+  map.maybe_unlock_blocks(mc_locking);
 } /* visit() */
 
 template<typename TBlockType>
@@ -165,16 +227,15 @@ void free_block_drop<TBlockType>::visit(caching_arena_map& map) {
   /* needed for atomic check for cache overlap+do drop operation */
   map.maybe_lock(map.cache_mtx(),
                  !(mc_locking & arena_map_locking::ekCACHES_HELD));
-
-  map.maybe_lock(map.block_mtx(),
-                 !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  map.maybe_lock_blocks(mc_locking);
 
   /*
    * We might be modifying this cell--don't want block distribution in ANOTHER
-   * thread to pick this cell for distribution.
+   * thread to pick this cell for distribution. As with \ref base_arena_map
+   * drops, we only lock the tile containing the cell if tiled locking was
+   * requested.
    */
-  map.maybe_lock(map.grid_mtx(),
-                 !(mc_locking & arena_map_locking::ekGRID_HELD));
+  map.maybe_lock_cell(cell2D_op::coord(), mc_locking);
 
   auto rloc = rmath::zvec2dvec(cell2D_op::coord(), mc_resolution.v());
   bool conflict = block_drop_loc_conflict(map,
@@ -194,17 +255,11 @@ void free_block_drop<TBlockType>::visit(caching_arena_map& map) {
    * need to drop the block in the host cell for the cache.
    */
   if (cell.state_has_cache() || cell.state_in_cache_extent()) {
-    cache_block_drop_visitor op(boost::get<crepr::base_block2D*>(mc_block),
-                                      static_cast<carepr::arena_cache*>(
-                                          cell.cache()),
-                                      mc_resolution,
-                                      arena_map_locking::ekALL_HELD);
-    op.visit(map);
+    cache_drop(map, static_cast<carepr::arena_cache*>(cell.cache()));
     map.maybe_unlock(map.cache_mtx(),
                      !(mc_locking & arena_map_locking::ekCACHES_HELD));
   } else if (cell.state_has_block() || conflict) {
-    map.distribute_single_block(boost::get<crepr::base_block2D*>(mc_block),
-                                arena_map_locking::ekALL_HELD);
+    redistribute(map, boost::get<crepr::base_block2D*>(mc_block));
     map.maybe_unlock(map.cache_mtx(),
                      !(mc_locking & arena_map_locking::ekCACHES_HELD));
   } else {
@@ -214,15 +269,14 @@ void free_block_drop<TBlockType>::visit(caching_arena_map& map) {
      * Cell does not have a block/cache on it, so it is safe to drop the block
      * on it and change the cell state.
      *
-     * Holding arena map grid lock, block lock if locking enabled.
+     * Holding (at least) the tile of the arena map grid containing the cell.
      */
     visit(cell);
+    map.clusters_update_after_drop(boost::get<crepr::base_block2D*>(mc_block));
   }
 
-  map.maybe_unlock(map.grid_mtx(),
-                   !(mc_locking & arena_map_locking::ekGRID_HELD));
-  map.maybe_unlock(map.block_mtx(),
-                   !(mc_locking & arena_map_locking::ekBLOCKS_HELD));
+  map.maybe_unlock_cell(cell2D_op::coord(), mc_locking);
+  map.maybe_unlock_blocks(mc_locking);
 } /* visit() */
 
 /*******************************************************************************
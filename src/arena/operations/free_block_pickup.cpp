@@ -56,6 +56,7 @@ void free_block_pickup::visit(base_arena_map<TBlockType>& map) {
   cdops::cell2D_empty_visitor op(cell2D_op::coord());
   map.grid_mtx()->lock();
   op.visit(map.decoratee());
+  map.clusters_update_after_pickup(m_block->id(), cell2D_op::coord());
   map.grid_mtx()->unlock();
 
   /*
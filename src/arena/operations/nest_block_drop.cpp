@@ -110,9 +110,9 @@ void do_lock(caching_arena_map& map) {
 } /* do_lock() */
 
 void do_unlock(caching_arena_map& map) {
-  map.grid_mtx()->lock();
-  map.block_mtx()->lock();
-  map.cache_mtx()->lock();
+  map.grid_mtx()->unlock();
+  map.block_mtx()->unlock();
+  map.cache_mtx()->unlock();
 } /* do_unlock() */
 
 void do_lock(base_arena_map<crepr::base_block2D>& map) {
@@ -121,8 +121,8 @@ void do_lock(base_arena_map<crepr::base_block2D>& map) {
 } /* do_lock() */
 
 void do_unlock(base_arena_map<crepr::base_block2D>& map) {
-  map.grid_mtx()->lock();
-  map.block_mtx()->lock();
+  map.grid_mtx()->unlock();
+  map.block_mtx()->unlock();
 } /* do_unlock() */
 
 NS_END(detail, operations, arena, cosm);
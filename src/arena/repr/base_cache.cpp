@@ -43,6 +43,7 @@ base_cache::base_cache(const params& p)
                                  p.center,
                                  p.resolution),
       colored_entity(rutils::color::kGRAY40),
+      ER_CLIENT_INIT("cosm.arena.repr.base_cache"),
       mc_resolution(p.resolution),
       m_blocks(p.blocks) {
   if (rtypes::constants::kNoUUID == p.id) {
@@ -56,14 +57,17 @@ base_cache::base_cache(const params& p)
  * Member Functions
  ******************************************************************************/
 void base_cache::block_remove(crepr::base_block2D* const block) {
-  m_blocks.erase(std::find_if(m_blocks.begin(),
-                              m_blocks.end(),
-                              [&](const auto& b) { return b->idcmp(*block); }));
+  m_blocks.remove(block);
 } /* block_remove() */
 
 std::unique_ptr<base_cache> base_cache::clone(void) const {
-  return std::make_unique<base_cache>(params{
-      rtypes::spatial_dist(xdimr()), mc_resolution, rloc(), m_blocks, id()});
+  auto ret = std::make_unique<base_cache>(params{rtypes::spatial_dist(xdimr()),
+                                                 mc_resolution,
+                                                 rloc(),
+                                                 cds::block2D_vectorno(),
+                                                 id()});
+  ret->m_blocks = m_blocks;
+  return ret;
 } /* clone() */
 
 NS_END(repr, arena, cosm);
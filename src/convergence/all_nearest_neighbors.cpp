@@ -0,0 +1,149 @@
+/**
+ * \file all_nearest_neighbors.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/convergence/all_nearest_neighbors.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, convergence);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::vector<double> all_nearest_neighbors::operator()(
+    const std::vector<rmath::vector2d>& pts,
+    uint n_threads) const {
+  size_t n_pts = pts.size();
+  if (n_pts < 2) {
+    return {};
+  }
+
+  /* bounding box of the points */
+  rmath::vector2d ll = pts[0];
+  rmath::vector2d ur = pts[0];
+  for (auto& pt : pts) {
+    ll = rmath::vector2d(std::min(ll.x(), pt.x()), std::min(ll.y(), pt.y()));
+    ur = rmath::vector2d(std::max(ur.x(), pt.x()), std::max(ur.y(), pt.y()));
+  } /* for(&pt..) */
+
+  /*
+   * Size cells so that there is ~1 point per cell, but no smaller than the
+   * longest side divided evenly among the points: if the points are (nearly)
+   * on a line the area is ~0, and the # of cells along the line would
+   * otherwise explode. Either way there are O(n) cells.
+   */
+  double xrange = ur.x() - ll.x();
+  double yrange = ur.y() - ll.y();
+  double cell_dim = std::max(std::sqrt(xrange * yrange / n_pts),
+                             std::max(xrange, yrange) / n_pts);
+  if (cell_dim <= 0.0) {
+    /* all points coincide */
+    return std::vector<double>(n_pts, 0.0);
+  }
+  auto xcells = static_cast<size_t>(xrange / cell_dim) + 1;
+  auto ycells = static_cast<size_t>(yrange / cell_dim) + 1;
+
+  auto cell_of = [&](const rmath::vector2d& pt) {
+    auto i = std::min(static_cast<size_t>((pt.x() - ll.x()) / cell_dim),
+                      xcells - 1);
+    auto j = std::min(static_cast<size_t>((pt.y() - ll.y()) / cell_dim),
+                      ycells - 1);
+    return rmath::vector2z(i, j);
+  };
+
+  /*
+   * Counting sort of the points by cell: the points in cell c are
+   * sorted[starts[c]]..sorted[starts[c + 1] - 1].
+   */
+  std::vector<size_t> starts(xcells * ycells + 1, 0);
+  std::vector<size_t> cells(n_pts);
+  for (size_t i = 0; i < n_pts; ++i) {
+    auto c = cell_of(pts[i]);
+    cells[i] = c.x() * ycells + c.y();
+    ++starts[cells[i] + 1];
+  } /* for(i..) */
+  for (size_t c = 1; c < starts.size(); ++c) {
+    starts[c] += starts[c - 1];
+  } /* for(c..) */
+  std::vector<size_t> sorted(n_pts);
+  std::vector<size_t> fill(starts.begin(), starts.end() - 1);
+  for (size_t i = 0; i < n_pts; ++i) {
+    sorted[fill[cells[i]]++] = i;
+  } /* for(i..) */
+
+  std::vector<double> res(n_pts);
+  auto max_ring = static_cast<long>(std::max(xcells, ycells));
+
+#pragma omp parallel for num_threads(n_threads)
+  for (size_t i = 0; i < n_pts; ++i) {
+    auto c = cell_of(pts[i]);
+    auto cx = static_cast<long>(c.x());
+    auto cy = static_cast<long>(c.y());
+    double best = std::numeric_limits<double>::max();
+
+    auto search_cell = [&](long x, long y) {
+      if (x < 0 || y < 0 || x >= static_cast<long>(xcells) ||
+          y >= static_cast<long>(ycells)) {
+        return;
+      }
+      size_t cell = static_cast<size_t>(x) * ycells + static_cast<size_t>(y);
+      for (size_t k = starts[cell]; k < starts[cell + 1]; ++k) {
+        if (sorted[k] != i) {
+          best = std::min(best, pts[i].distance(pts[sorted[k]]));
+        }
+      } /* for(k..) */
+    };
+
+    /*
+     * Any point outside of rings 0..r is > r * cell_dim away, so once we have
+     * found a point at least that close, we are done.
+     */
+    for (long r = 0; r <= max_ring; ++r) {
+      if (0 == r) {
+        search_cell(cx, cy);
+      } else {
+        for (long x = cx - r; x <= cx + r; ++x) {
+          search_cell(x, cy - r);
+          search_cell(x, cy + r);
+        } /* for(x..) */
+        for (long y = cy - r + 1; y <= cy + r - 1; ++y) {
+          search_cell(cx - r, y);
+          search_cell(cx + r, y);
+        } /* for(y..) */
+      }
+      if (best <= r * cell_dim) {
+        break;
+      }
+    } /* for(r..) */
+    res[i] = best;
+  } /* for(i..) */
+
+  return res;
+} /* operator()() */
+
+NS_END(convergence, cosm);
@@ -32,6 +32,10 @@
 
 #include "cosm/convergence/convergence_calculator.hpp"
 
+#include <algorithm>
+
+#include "cosm/convergence/all_nearest_neighbors.hpp"
+
 /*******************************************************************************
  * Namespaces/Decls
  ******************************************************************************/
@@ -49,45 +53,43 @@ NS_START(cosm, convergence);
  * same number/type of parameters. This could also be solved with a parameter
  * base class/derived classes and dynamic casting, but I think this is cleaner.
  *
- * It is passed the callbacks from the calculator, rather than the results, so
- * that it is only if a specific type of convergence calculation is enabled that
- * the necessary input data is generated, as this may be as expensive as the
- * actual convergence calculation itself.
+ * It is passed the swarm snapshot gathered once by the calculator for the
+ * current timestep, which is shared by all measures which need it, and the task
+ * callback, so that the task distribution is only computed if \ref
+ * task_dist_entropy is enabled, as this may be as expensive as the actual
+ * convergence calculation itself.
  */
 class convergence_measure_updater : public boost::static_visitor<void> {
  public:
   convergence_measure_updater(
       uint n,
-      const boost::optional<convergence_calculator::headings_calc_cb_type>& headings_calc,
-      const boost::optional<convergence_calculator::nn_calc_cb_type>& nn_calc,
-      const boost::optional<convergence_calculator::pos_calc_cb_type>& pos_calc,
+      const swarm_snapshot* snapshot,
       const boost::optional<convergence_calculator::tasks_calc_cb_type>& tasks_calc)
       : m_n_threads(n),
-        m_headings_calc(headings_calc),
-        m_nn_calc(nn_calc),
-        m_pos_calc(pos_calc),
+        mc_snapshot(snapshot),
         m_tasks_calc(tasks_calc) {}
+
   void operator()(interactivity& i) {
-    if (m_nn_calc) {
-      i((*m_nn_calc)(m_n_threads)); }
+    if (nullptr != mc_snapshot) {
+      i(all_nearest_neighbors()(mc_snapshot->positions, m_n_threads));
     }
+  }
 
   void operator()(angular_order& ang) {
-    if (m_headings_calc) {
-      ang((*m_headings_calc)(m_n_threads), m_n_threads);
+    if (nullptr != mc_snapshot) {
+      ang(mc_snapshot->headings, m_n_threads);
     }
   }
 
   void operator()(positional_entropy& pos) {
-    if (m_pos_calc) {
-      pos((*m_pos_calc)(m_n_threads));
+    if (nullptr != mc_snapshot) {
+      pos(mc_snapshot->positions);
     }
   }
 
   void operator()(velocity& vel) {
-    if (m_pos_calc) {
-      vel((*m_pos_calc)(m_n_threads));
-
+    if (nullptr != mc_snapshot) {
+      vel(mc_snapshot->positions, m_n_threads);
     }
   }
 
@@ -99,11 +101,9 @@ class convergence_measure_updater : public boost::static_visitor<void> {
 
  private:
   /* clang-format off */
-  uint                                                           m_n_threads;
-  boost::optional<convergence_calculator::headings_calc_cb_type> m_headings_calc;
-  boost::optional<convergence_calculator::nn_calc_cb_type>       m_nn_calc;
-  boost::optional<convergence_calculator::pos_calc_cb_type>      m_pos_calc;
-  boost::optional<convergence_calculator::tasks_calc_cb_type>    m_tasks_calc;
+  uint                                                        m_n_threads;
+  const swarm_snapshot*                                       mc_snapshot;
+  boost::optional<convergence_calculator::tasks_calc_cb_type> m_tasks_calc;
   /* clang-format on */
 };
 
@@ -124,13 +124,15 @@ struct convergence_status_collator : public boost::static_visitor<bool> {
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-void convergence_calculator::angular_order_init(const headings_calc_cb_type& cb) {
-  m_headings_calc = boost::make_optional(cb);
+void convergence_calculator::snapshot_init(const snapshot_calc_cb_type& cb) {
+  m_snapshot_calc = boost::make_optional(cb);
+} /* snapshot_init() */
+
+void convergence_calculator::angular_order_init(void) {
   m_measures.emplace(typeid(angular_order), angular_order(mc_config.epsilon));
 } /* angular_order_init() */
 
-void convergence_calculator::interactivity_init(const nn_calc_cb_type& cb) {
-  m_nn_calc = boost::make_optional(cb);
+void convergence_calculator::interactivity_init(void) {
   m_measures.emplace(typeid(interactivity), interactivity(mc_config.epsilon));
 } /* interactivity_init() */
 
@@ -140,11 +142,7 @@ void convergence_calculator::task_dist_entropy_init(const tasks_calc_cb_type &cb
                        task_dist_entropy(mc_config.epsilon));
 } /* task_dist_init() */
 
-void convergence_calculator::positional_entropy_init(const pos_calc_cb_type &cb) {
-  /* velocity and positional entropy use the same callback */
-  if (!m_pos_calc) {
-    m_pos_calc = boost::make_optional(cb);
-  }
+void convergence_calculator::positional_entropy_init(void) {
     m_measures.emplace(
         typeid(positional_entropy),
         positional_entropy(
@@ -154,19 +152,27 @@ void convergence_calculator::positional_entropy_init(const pos_calc_cb_type &cb)
             &mc_config.pos_entropy));
 } /* positional_entropy_init() */
 
-void convergence_calculator::velocity_init(const pos_calc_cb_type& cb) {
-  /* velocity and positional entropy use the same callback */
-  if (!m_pos_calc) {
-    m_pos_calc = boost::make_optional(cb);
-  }
+void convergence_calculator::velocity_init(void) {
   m_measures.emplace(typeid(velocity), velocity(mc_config.epsilon));
 } /* velocity_init() */
 
 void convergence_calculator::update(void) {
+  /*
+   * Gather the swarm state needed by all measures other than task distribution
+   * entropy exactly once, rather than once per measure.
+   */
+  bool need_snapshot = std::any_of(m_measures.begin(),
+                                   m_measures.end(),
+                                   [&](const auto& m) {
+                                     return m.first != typeid(task_dist_entropy);
+                                   });
+  const swarm_snapshot* snapshot = nullptr;
+  if (m_snapshot_calc && need_snapshot) {
+    (*m_snapshot_calc)(&m_snapshot, mc_config.n_threads);
+    snapshot = &m_snapshot;
+  }
   convergence_measure_updater u{mc_config.n_threads,
-                                m_headings_calc,
-                                m_nn_calc,
-                                m_pos_calc,
+                                snapshot,
                                 m_tasks_calc};
   for (auto& m : m_measures) {
     boost::apply_visitor(u, m.second);
@@ -0,0 +1,89 @@
+/**
+ * \file block2D_fifo.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/ds/block2D_fifo.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "cosm/repr/base_block2D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, ds);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+block2D_fifo::block2D_fifo(const block2D_vectorno& blocks) : block2D_fifo() {
+  for (auto* block : blocks) {
+    push_back(block);
+  } /* for(*block..) */
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool block2D_fifo::push_back(value_type block) {
+  auto& s = storage_mut();
+  if (!s.ids.insert(block->id().v()).second) {
+    return false;
+  }
+  s.blocks.push_back(block);
+  return true;
+} /* push_back() */
+
+bool block2D_fifo::remove(const crepr::base_block2D* const block) {
+  if (!contains(block->id())) {
+    return false;
+  }
+  auto& s = storage_mut();
+  s.ids.erase(block->id().v());
+  if (s.blocks.front()->idcmp(*block)) {
+    s.blocks.pop_front();
+  } else {
+    s.blocks.erase(std::find_if(s.blocks.begin(),
+                                s.blocks.end(),
+                                [&](const auto& b) { return b->idcmp(*block); }));
+  }
+  return true;
+} /* remove() */
+
+std::string block2D_fifo::to_str(void) const {
+  return std::accumulate(begin(),
+                         end(),
+                         std::string(),
+                         [&](const std::string& a, const auto& b) {
+                           return a + "b" + rcppsw::to_string(b->id()) + ",";
+                         });
+} /* to_str() */
+
+block2D_fifo::storage& block2D_fifo::storage_mut(void) {
+  if (m_storage.use_count() > 1) {
+    m_storage = std::make_shared<storage>(*m_storage);
+  }
+  return *m_storage;
+} /* storage_mut() */
+
+NS_END(ds, cosm);
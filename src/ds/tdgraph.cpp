@@ -50,11 +50,11 @@ const polled_task* tdgraph::root(void) const { return m_root; }
 polled_task* tdgraph::root(void) { return m_root; }
 
 const polled_task* tdgraph::find_vertex(const std::string& task_name) const {
-  return m_impl[*find_vertex_impl(task_name)].get();
+  return find_vertex_impl(task_name);
 } /* find_vertex() */
 
 polled_task* tdgraph::find_vertex(const std::string& task_name) {
-  return m_impl[*find_vertex_impl(task_name)].get();
+  return find_vertex_impl(task_name);
 } /* find_vertex() */
 
 const polled_task* tdgraph::find_vertex(int id) const {
@@ -66,21 +66,19 @@ polled_task* tdgraph::find_vertex(int id) {
 } /* find_vertex() */
 
 int tdgraph::vertex_id(const polled_task* const v) const {
-  auto it = find_vertex_impl(v);
-  if (it == boost::vertices(m_impl).second) {
+  if (!contains(v)) {
     ER_WARN("No such vertex %s found in graph", v->name().c_str());
     return -1;
   }
-  return *it;
+  return v->m_vertex_id;
 } /* vertex_id() */
 
 int tdgraph::vertex_depth(const polled_task* const v) const {
-  auto it = find_vertex_impl(v);
-  if (it == boost::vertices(m_impl).second) {
+  if (!contains(v)) {
     ER_WARN("No such vertex %s found in graph", v->name().c_str());
     return -1;
   }
-  return vertex_depth_impl(v, 0);
+  return v->m_vertex_depth;
 } /* vertex_depth() */
 
 void tdgraph::walk(const walk_cb& f) {
@@ -101,59 +99,45 @@ void tdgraph::walk(const const_walk_cb& f) const {
   } /* while() */
 } /* walk() */
 
-uint tdgraph::vertex_depth_impl(const polled_task* const v, int depth) const {
-  /*
-   * Only the root's parent is equal to itself.
-   */
-  if (vertex_parent(v) == v) {
-    return depth;
-  } else {
-    return vertex_depth_impl(vertex_parent(v), depth + 1);
-  }
-} /* vertex_depth_impl() */
-
-tdgraph::vertex_iterator tdgraph::find_vertex_impl(
-    const polled_task* const v) const {
-  vertex_iterator v_i, v_end;
-  boost::tie(v_i, v_end) = boost::vertices(m_impl);
-  auto it = std::find_if(v_i, v_end, [&](const tdgraph::vertex_desc& tmp) {
-    return v == m_impl[tmp].get();
-  });
-  return it;
-} /* find_vertex_impl() */
+bool tdgraph::contains(const polled_task* const v) const {
+  return v->m_vertex_id >= 0 &&
+         static_cast<size_t>(v->m_vertex_id) < m_tasks.size() &&
+         m_tasks[static_cast<size_t>(v->m_vertex_id)] == v;
+} /* contains() */
 
-tdgraph::vertex_iterator tdgraph::find_vertex_impl(const std::string& v) const {
-  vertex_iterator v_i, v_end;
-  boost::tie(v_i, v_end) = boost::vertices(m_impl);
-  auto it = std::find_if(v_i, v_end, [&](const tdgraph::vertex_desc& tmp) {
-    return v == m_impl[tmp]->name();
-  });
-  return it;
+polled_task* tdgraph::find_vertex_impl(const std::string& v) const {
+  auto it = m_ids.find(v);
+  return (m_ids.end() == it) ? nullptr
+                             : m_tasks[static_cast<size_t>(it->second)];
 } /* find_vertex_impl() */
 
 polled_task* tdgraph::vertex_parent(const polled_task* const v) const {
-  auto found = find_vertex_impl(v);
-  if (found == boost::vertices(m_impl).second) {
+  if (!contains(v)) {
     ER_WARN("No such vertex %s found in graph", v->name().c_str());
     return nullptr;
   }
-  /*
-   * Now, we can just look in the incident edges for the vertex and return the
-   * one we find (if there is more than 1, that's an error).
-   */
-  in_edge_iterator ie, ie_end;
-  boost::tie(ie, ie_end) = boost::in_edges(*found, m_impl);
-  ER_ASSERT(1 == ie_end - ie,
-            "Vertex %s has more than 1 parent",
-            v->name().c_str());
-  return m_impl[boost::source(*ie, m_impl)].get();
+  return v->m_vertex_parent;
 } /* vertex_parent() */
 
+tdgraph::vertex_desc tdgraph::vertex_add(vertex_type v, polled_task* parent) {
+  auto* task = v.get();
+  vertex_desc new_v =
+      boost::add_vertex(std::shared_ptr<polled_task>(std::move(v)), m_impl);
+
+  /* Only the root's parent is equal to itself */
+  task->m_vertex_id = static_cast<int>(new_v);
+  task->m_vertex_parent = (nullptr == parent) ? task : parent;
+  task->m_vertex_depth = (nullptr == parent) ? 0 : parent->m_vertex_depth + 1;
+  m_tasks.push_back(task);
+  m_ids.insert({task->name(), task->m_vertex_id});
+  return new_v;
+} /* vertex_add() */
+
 status_t tdgraph::set_root(vertex_type v) {
   vertex_desc new_v;
   ER_CHECK(0 == boost::num_edges(m_impl), "Root already set for graph!");
   m_root = v.get();
-  new_v = boost::add_vertex(std::shared_ptr<polled_task>(std::move(v)), m_impl);
+  new_v = vertex_add(std::move(v), nullptr);
   boost::add_edge(new_v, new_v, m_impl); /* parent of root is root */
   return OK;
 
@@ -163,14 +147,14 @@ error:
 
 std::vector<polled_task*> tdgraph::children(
     const polled_task* const parent) const {
-  auto it = find_vertex_impl(parent);
-  ER_ASSERT(it != boost::vertices(m_impl).second,
+  ER_ASSERT(contains(parent),
             "No such vertex %s found in graph",
             parent->name().c_str());
   std::vector<polled_task*> kids;
   out_edge_iterator oe, oe_end;
 
-  boost::tie(oe, oe_end) = boost::out_edges(*it, m_impl);
+  boost::tie(oe, oe_end) = boost::out_edges(
+      static_cast<vertex_desc>(parent->m_vertex_id), m_impl);
   while (oe != oe_end) {
     kids.push_back(m_impl[boost::target(*oe, m_impl)].get());
     ++oe;
@@ -181,32 +165,35 @@ std::vector<polled_task*> tdgraph::children(
 
 status_t tdgraph::set_children(const std::string& parent,
                                vertex_vector children) {
-  return set_children(m_impl[*find_vertex_impl(parent)].get(),
-                      std::move(children));
+  const auto* vertex = find_vertex_impl(parent);
+  ER_CHECK(nullptr != vertex, "No such vertex %s in graph", parent.c_str());
+  return set_children(vertex, std::move(children));
+
+error:
+  return ERROR;
 } /* set_children() */
 
 status_t tdgraph::set_children(const polled_task* parent,
                                vertex_vector children) {
-  out_edge_iterator oe_start, oe_end;
-  auto vertex_d = find_vertex_impl(parent);
-  ER_CHECK(vertex_d != boost::vertices(m_impl).second,
+  vertex_desc vertex_d;
+  ER_CHECK(contains(parent),
            "No such vertex %s in graph",
            parent->name().c_str());
+  vertex_d = static_cast<vertex_desc>(parent->m_vertex_id);
 
   /* The root always has "children", in the sense it points to itself */
-  if (m_impl[*vertex_d].get() != m_root) {
-    ER_CHECK(0 == boost::out_degree(*vertex_d, m_impl),
+  if (m_impl[vertex_d].get() != m_root) {
+    ER_CHECK(0 == boost::out_degree(vertex_d, m_impl),
              "Graph vertex %s already has children",
-             m_impl[*vertex_d]->name().c_str());
+             m_impl[vertex_d]->name().c_str());
   }
 
   for (auto& c : children) {
-    vertex_desc new_v =
-        boost::add_vertex(std::shared_ptr<polled_task>(std::move(c)), m_impl);
+    vertex_desc new_v = vertex_add(std::move(c), m_tasks[vertex_d]);
     ER_TRACE("Add edge %s -> %s",
-             m_impl[*vertex_d]->name().c_str(),
+             m_impl[vertex_d]->name().c_str(),
              m_impl[new_v]->name().c_str());
-    boost::add_edge(*vertex_d, new_v, m_impl);
+    boost::add_edge(vertex_d, new_v, m_impl);
   } /* for(c..) */
   return OK;
 
@@ -39,13 +39,15 @@ NS_START(cosm, foraging, block_dist);
 template<typename TBlockType>
 cluster_distributor<TBlockType>::cluster_distributor(
     const cds::arena_grid::view& view,
+    const cds::arena_grid* const arena_grid,
     const rtypes::discretize_ratio& resolution,
+    const rmath::vector2d& max_block_dims,
     uint capacity,
     rmath::rng* rng)
     : ER_CLIENT_INIT("cosm.foraging.block_dist.cluster"),
       base_distributor<TBlockType>(rng),
       m_clust(view, resolution, capacity),
-      m_impl(view, resolution, rng) {}
+      m_impl(view, arena_grid, resolution, max_block_dims, rng) {}
 
 /*******************************************************************************
  * Member Functions
@@ -59,7 +61,11 @@ bool cluster_distributor<TBlockType>::distribute_block(TBlockType* block,
              m_clust.capacity());
     return false;
   }
-  return m_impl.distribute_block(block, entities);
+  if (m_impl.distribute_block(block, entities)) {
+    m_clust.update_after_drop(block);
+    return true;
+  }
+  return false;
 } /* distribute_block() */
 
 template<typename TBlockType>
@@ -72,7 +78,13 @@ bool cluster_distributor<TBlockType>::distribute_blocks(block_vectorno_type& blo
         m_clust.capacity());
     return false;
   }
-  return m_impl.distribute_blocks(blocks, entities);
+  bool ret = m_impl.distribute_blocks(blocks, entities);
+
+  /* Some blocks may have been distributed even on failure */
+  for (auto* block : blocks) {
+    m_clust.update_after_drop(block);
+  } /* for(*block..) */
+  return ret;
 } /* distribute_blocks() */
 
 template<typename TBlockType>
@@ -71,7 +71,8 @@ dispatcher<TBlockType>::~dispatcher(void) = default;
  * Member Functions
  ******************************************************************************/
 template<typename TBlockType>
-bool dispatcher<TBlockType>::initialize(rmath::rng* rng) {
+bool dispatcher<TBlockType>::initialize(rmath::rng* rng,
+                                        const rmath::vector2d& max_block_dims) {
   /* clang-format off */
     cds::arena_grid::view arena = m_grid->layer<arena_grid::kCell>()->subgrid(
         rmath::vector2z(static_cast<size_t>(mc_arena_xrange.lb()),
@@ -81,7 +82,9 @@ bool dispatcher<TBlockType>::initialize(rmath::rng* rng) {
 
   if (kDistRandom == mc_dist_type) {
     m_dist = std::make_unique<random_distributor<TBlockType>>(arena,
+                                                             m_grid,
                                                              mc_resolution,
+                                                             max_block_dims,
                                                              rng);
   } else if (kDistSingleSrc == mc_dist_type) {
     cds::arena_grid::view area = m_grid->layer<arena_grid::kCell>()->subgrid(
@@ -91,7 +94,9 @@ bool dispatcher<TBlockType>::initialize(rmath::rng* rng) {
                         static_cast<size_t>(mc_arena_yrange.ub())));
     m_dist = std::make_unique<cluster_distributor<TBlockType>>(
         area,
+        m_grid,
         mc_resolution,
+        max_block_dims,
         std::numeric_limits<uint>::max(),
         rng);
   } else if (kDistDualSrc == mc_dist_type) {
@@ -108,7 +113,9 @@ bool dispatcher<TBlockType>::initialize(rmath::rng* rng) {
     std::vector<cds::arena_grid::view> grids{area_l, area_r};
     m_dist = std::make_unique<multi_cluster_distributor<TBlockType>>(
         grids,
+        m_grid,
         mc_resolution,
+        max_block_dims,
         std::numeric_limits<uint>::max(),
         rng);
   } else if (kDistQuadSrc == mc_dist_type) {
@@ -141,12 +148,15 @@ bool dispatcher<TBlockType>::initialize(rmath::rng* rng) {
     std::vector<cds::arena_grid::view> grids{area_l, area_r, area_b, area_u};
     m_dist = std::make_unique<multi_cluster_distributor<TBlockType>>(
         grids,
+        m_grid,
         mc_resolution,
+        max_block_dims,
         std::numeric_limits<uint>::max(),
         rng);
   } else if (kDistPowerlaw == mc_dist_type) {
     auto p = std::make_unique<powerlaw_distributor<TBlockType>>(&mc_config.powerlaw,
                                                                 mc_resolution,
+                                                                max_block_dims,
                                                                 rng);
     if (!p->map_clusters(m_grid)) {
       return false;
@@ -37,13 +37,16 @@ NS_START(cosm, foraging, block_dist);
 template<typename TBlockType>
 multi_cluster_distributor<TBlockType>::multi_cluster_distributor(
     std::vector<cds::arena_grid::view>& grids,
+    const cds::arena_grid* const arena_grid,
     rtypes::discretize_ratio resolution,
+    const rmath::vector2d& max_block_dims,
     uint maxsize,
     rmath::rng* rng_in)
     : ER_CLIENT_INIT("cosm.foraging.block_dist.multi_cluster"),
       base_distributor<TBlockType>(rng_in) {
   for (auto& g : grids) {
-    m_dists.emplace_back(g, resolution, maxsize, rng_in);
+    m_dists.emplace_back(
+        g, arena_grid, resolution, max_block_dims, maxsize, rng_in);
   } /* for(i..) */
 }
 
@@ -88,6 +91,30 @@ cfds::block_cluster_vector<TBlockType> multi_cluster_distributor<TBlockType>::bl
   return ret;
 } /* block_clusters() */
 
+template<typename TBlockType>
+void multi_cluster_distributor<TBlockType>::clusters_update_after_drop(
+    const TBlockType* block) {
+  for (auto& dist : m_dists) {
+    dist.clusters_update_after_drop(block);
+  } /* for(&dist..) */
+} /* clusters_update_after_drop() */
+
+template<typename TBlockType>
+void multi_cluster_distributor<TBlockType>::clusters_update_after_pickup(
+    const rtypes::type_uuid& id,
+    const rmath::vector2z& coord) {
+  for (auto& dist : m_dists) {
+    dist.clusters_update_after_pickup(id, coord);
+  } /* for(&dist..) */
+} /* clusters_update_after_pickup() */
+
+template<typename TBlockType>
+void multi_cluster_distributor<TBlockType>::clusters_recalc(void) {
+  for (auto& dist : m_dists) {
+    dist.clusters_recalc();
+  } /* for(&dist..) */
+} /* clusters_recalc() */
+
 /*******************************************************************************
  * Template Instantiations
  ******************************************************************************/
@@ -25,6 +25,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <queue>
 
 #include "cosm/ds/arena_grid.hpp"
 #include "cosm/foraging/config/block_dist_config.hpp"
@@ -43,10 +49,12 @@ template<typename TBlockType>
 powerlaw_distributor<TBlockType>::powerlaw_distributor(
     const config::powerlaw_dist_config* const config,
     const rtypes::discretize_ratio& resolution,
+    const rmath::vector2d& max_block_dims,
     rmath::rng* rng_in)
     : ER_CLIENT_INIT("cosm.foraging.block_dist.powerlaw"),
       base_distributor<TBlockType>(rng_in),
       mc_resolution(resolution),
+      mc_max_block_dims(max_block_dims),
       m_n_clusters(config->n_clusters),
       m_pwrdist(config->pwr_min, config->pwr_max, 2) {}
 
@@ -82,77 +90,143 @@ bool powerlaw_distributor<TBlockType>::distribute_block(TBlockType* block,
 } /* distribute_block() */
 
 template<typename TBlockType>
-typename powerlaw_distributor<TBlockType>::cluster_paramvec powerlaw_distributor<TBlockType>::guess_cluster_placements(
-    cds::arena_grid* const grid,
-    const std::vector<uint>& clust_sizes) {
-  cluster_paramvec config;
+typename powerlaw_distributor<TBlockType>::cluster_placement powerlaw_distributor<TBlockType>::guess_cluster_placement(
+    const cds::arena_grid* const grid,
+    uint clust_size,
+    rmath::rng* const rng) {
+  uint x_len = static_cast<uint>(std::sqrt(clust_size));
+  uint y_len = clust_size / x_len;
 
-  for (size_t i = 0; i < clust_sizes.size(); ++i) {
-    uint x = rng()->uniform(clust_sizes[i] / 2 + 1,
-                            grid->xdsize() - clust_sizes[i] / 2 - 1);
-    uint y = rng()->uniform(clust_sizes[i] / 2 + 1,
-                            grid->ydsize() - clust_sizes[i] / 2 - 1);
-    uint x_max = x + static_cast<uint>(std::sqrt(clust_sizes[i]));
-    uint y_max = y + clust_sizes[i] / (x_max - x);
-
-    /*
-     * Cast needed so that clusters can correctly be constructed later, and they
-     * DO need to be able to modify their grid view. Here we do not need it, so
-     * we have to cast.
-     */
-    auto view = grid->layer<arena_grid::kCell>()->subgrid(rmath::vector2z(x, x_max),
-                                                          rmath::vector2z(y, y_max));
-    RCSW_UNUSED rmath::vector2z loc = (*view.origin()).loc();
-    ER_TRACE("Guess cluster%zu placement x=[%lu-%lu], y=[%lu-%lu], size=%u",
-             i,
-             loc.x() + view.index_bases()[0],
-             loc.x() + view.index_bases()[0] + view.shape()[0],
-             loc.y() + view.index_bases()[1],
-             loc.y() + view.index_bases()[1] + view.shape()[1],
-             clust_sizes[i]);
-    config.push_back({view, clust_sizes[i]});
-  } /* for(i..) */
-  return config;
+  /*
+   * Bounds are closed, so the upper right corner must be at most (xdsize - 1,
+   * ydsize - 1). If the cluster does not fit, pick the lower bound and let the
+   * caller reject the placement.
+   */
+  auto ub = [&](size_t dsize, uint len) {
+    size_t margin = std::max(clust_size / 2, len) + 1;
+    return static_cast<uint>((dsize > margin) ? dsize - margin : 0);
+  };
+  uint lb = clust_size / 2 + 1;
+  uint x = rng->uniform(lb, std::max(lb, ub(grid->xdsize(), x_len)));
+  uint y = rng->uniform(lb, std::max(lb, ub(grid->ydsize(), y_len)));
+  return {rmath::vector2z(x, y),
+          rmath::vector2z(x + x_len, y + y_len),
+          clust_size};
+} /* guess_cluster_placement() */
+
+template<typename TBlockType>
+bool powerlaw_distributor<TBlockType>::placement_in_grid(
+    const cds::arena_grid* const grid,
+    const cluster_placement& p) {
+  return p.ll.x() <= p.ur.x() && p.ll.y() <= p.ur.y() &&
+         p.ur.x() < grid->xdsize() && p.ur.y() < grid->ydsize();
+} /* placement_in_grid() */
+
+template<typename TBlockType>
+typename powerlaw_distributor<TBlockType>::placement_vector powerlaw_distributor<TBlockType>::guess_cluster_placements(
+    const cds::arena_grid* const grid,
+    const std::vector<uint>& clust_sizes,
+    rmath::rng* const rng) {
+  placement_vector pvec;
+  pvec.reserve(clust_sizes.size());
+
+  for (auto size : clust_sizes) {
+    pvec.push_back(guess_cluster_placement(grid, size, rng));
+  } /* for(size..) */
+  return pvec;
 } /* guess_cluster_placements() */
 
 template<typename TBlockType>
-bool powerlaw_distributor<TBlockType>::check_cluster_placements(const cluster_paramvec& pvec) {
-  for (const cluster_config& p : pvec) {
-    bool overlap = std::any_of(pvec.begin(), pvec.end(), [&](const auto& other) {
-      /*
-         * Can't compare directly (boost multi_array makes a COPY of each
-         * element during iteration for some reason, and because the cells
-         * have a unique_ptr, that doesn't work), so compare using addresses
-         * of elements of the vector, which WILL work.
-         */
-      if (&other == &p) { /* self */
-        return false;
-      }
-      rmath::vector2z v_loc = (*p.view.origin()).loc();
-      rmath::vector2z other_loc = (*other.view.origin()).loc();
-      rmath::rangeu v_xrange(v_loc.x() + p.view.index_bases()[0],
-                             v_loc.x() + p.view.index_bases()[0] +
-                                 p.view.shape()[0]);
-      rmath::rangeu v_yrange(v_loc.y() + p.view.index_bases()[1],
-                             v_loc.y() + p.view.index_bases()[1] +
-                                 p.view.shape()[1]);
-      rmath::rangeu other_xrange(other_loc.x() + other.view.index_bases()[0],
-                                 other_loc.x() + other.view.index_bases()[0] +
-                                     other.view.shape()[0]);
-      rmath::rangeu other_yrange(other_loc.y() + other.view.index_bases()[1],
-                                 other_loc.y() + other.view.index_bases()[1] +
-                                     other.view.shape()[1]);
-
-      return v_xrange.overlaps_with(other_xrange) &&
-             v_yrange.overlaps_with(other_yrange);
-    });
-    if (overlap) {
+bool powerlaw_distributor<TBlockType>::check_cluster_placements(
+    const placement_vector& pvec) {
+  std::vector<const cluster_placement*> sorted(pvec.size());
+  std::transform(pvec.begin(),
+                 pvec.end(),
+                 sorted.begin(),
+                 [](const auto& p) { return &p; });
+  std::sort(sorted.begin(), sorted.end(), [](const auto* p1, const auto* p2) {
+    return p1->ll.x() < p2->ll.x();
+  });
+
+  /*
+   * Y extents [lb, ub] of the placements which overlap the sweep line in X,
+   * keyed by lb. Any two of these overlap in X, so if no overlap has been
+   * found yet they are disjoint in Y, and only the extent with the greatest lb
+   * not past a new placement's Y extent can overlap it.
+   */
+  std::map<size_t, size_t> active;
+
+  /* X upper bounds of the active placements, for removal once passed */
+  using expiry_type = std::pair<size_t, size_t>;
+  std::priority_queue<expiry_type,
+                      std::vector<expiry_type>,
+                      std::greater<expiry_type>>
+      expiries;
+
+  for (const auto* p : sorted) {
+    while (!expiries.empty() && expiries.top().first < p->ll.x()) {
+      active.erase(expiries.top().second);
+      expiries.pop();
+    } /* while(!expiries.empty()..) */
+
+    auto it = active.upper_bound(p->ur.y());
+    if (active.begin() != it && std::prev(it)->second >= p->ll.y()) {
       return false;
     }
-  } /* for(&p..) */
+    active.emplace(p->ll.y(), p->ur.y());
+    expiries.emplace(p->ur.x(), p->ll.y());
+  } /* for(*p..) */
   return true;
 } /* check_cluster_placements() */
 
+template<typename TBlockType>
+typename powerlaw_distributor<TBlockType>::placement_vector powerlaw_distributor<TBlockType>::pack_cluster_placements(
+    const cds::arena_grid* const grid,
+    const std::vector<uint>& clust_sizes) {
+  std::vector<size_t> order(clust_sizes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+    return clust_sizes[i] > clust_sizes[j];
+  });
+
+  /* cells covered by the (closed) bounds of the clusters placed so far */
+  std::vector<bool> occupied(grid->xdsize() * grid->ydsize(), false);
+  auto visit_cells = [&](const cluster_placement& p, auto&& f) {
+    if (!placement_in_grid(grid, p)) {
+      return false;
+    }
+    for (size_t i = p.ll.x(); i <= p.ur.x(); ++i) {
+      for (size_t j = p.ll.y(); j <= p.ur.y(); ++j) {
+        if (!f(i * grid->ydsize() + j)) {
+          return false;
+        }
+      } /* for(j..) */
+    } /* for(i..) */
+    return true;
+  };
+
+  placement_vector pvec(clust_sizes.size());
+  for (auto i : order) {
+    bool placed = false;
+    for (uint j = 0; j < kMAX_DIST_TRIES && !placed; ++j) {
+      auto guess = guess_cluster_placement(grid, clust_sizes[i], rng());
+      placed = visit_cells(guess, [&](size_t cell) { return !occupied[cell]; });
+      if (placed) {
+        visit_cells(guess, [&](size_t cell) {
+          occupied[cell] = true;
+          return true;
+        });
+        pvec[i] = guess;
+      }
+    } /* for(j..) */
+    if (!placed) {
+      ER_WARN("Unable to pack cluster%zu: size=%u", i, clust_sizes[i]);
+      return placement_vector{};
+    }
+  } /* for(i..) */
+  return pvec;
+} /* pack_cluster_placements() */
+
 template<typename TBlockType>
 typename powerlaw_distributor<TBlockType>::cluster_paramvec powerlaw_distributor<TBlockType>::
     compute_cluster_placements(cds::arena_grid* const grid, uint n_clusters) {
@@ -166,15 +240,75 @@ typename powerlaw_distributor<TBlockType>::cluster_paramvec powerlaw_distributor
     clust_sizes.push_back(index);
   } /* for(i..) */
 
+  std::vector<uint> seeds(kMAX_DIST_TRIES);
+  for (auto& seed : seeds) {
+    seed = rng()->uniform(0U, std::numeric_limits<uint>::max());
+  } /* for(&seed..) */
+
+  uint best = kMAX_DIST_TRIES;
+  placement_vector pvec;
+
+#pragma omp parallel for schedule(dynamic)
   for (uint i = 0; i < kMAX_DIST_TRIES; ++i) {
-    auto views = guess_cluster_placements(grid, clust_sizes);
-    if (check_cluster_placements(views)) {
-      return views;
+    uint curr;
+#pragma omp atomic read
+    curr = best;
+
+    /* a valid guess earlier in the order has already been found */
+    if (i > curr) {
+      continue;
+    }
+    rmath::rng stream(seeds[i]);
+    auto guess = guess_cluster_placements(grid, clust_sizes, &stream);
+    bool in_grid = std::all_of(guess.begin(), guess.end(), [&](const auto& p) {
+      return placement_in_grid(grid, p);
+    });
+    if (in_grid && check_cluster_placements(guess)) {
+#pragma omp critical
+      {
+        if (i < best) {
+          pvec = std::move(guess);
+#pragma omp atomic write
+          best = i;
+        }
+      }
     }
   } /* for(i..) */
-  ER_FATAL_SENTINEL(
-      "Unable to place clusters in arena (impossible situation?)");
-  return cluster_paramvec{};
+
+  if (kMAX_DIST_TRIES == best) {
+    ER_WARN("No valid cluster placement after %u guesses: packing clusters",
+            kMAX_DIST_TRIES);
+    pvec = pack_cluster_placements(grid, clust_sizes);
+    if (pvec.empty()) {
+      ER_FATAL_SENTINEL(
+          "Unable to place clusters in arena (impossible situation?)");
+      return cluster_paramvec{};
+    }
+  } else {
+    ER_INFO("Found valid cluster placement after %u guesses", best + 1);
+  }
+
+  cluster_paramvec config;
+  for (size_t i = 0; i < pvec.size(); ++i) {
+    ER_ASSERT(placement_in_grid(grid, pvec[i]),
+              "Cluster%zu placement x=[%zu-%zu], y=[%zu-%zu] outside grid",
+              i,
+              pvec[i].ll.x(),
+              pvec[i].ur.x(),
+              pvec[i].ll.y(),
+              pvec[i].ur.y());
+    auto view = grid->layer<arena_grid::kCell>()->subgrid(pvec[i].ll,
+                                                          pvec[i].ur);
+    ER_TRACE("Cluster%zu placement x=[%zu-%zu], y=[%zu-%zu], size=%u",
+             i,
+             pvec[i].ll.x(),
+             pvec[i].ur.x(),
+             pvec[i].ll.y(),
+             pvec[i].ur.y(),
+             pvec[i].capacity);
+    config.push_back({view, pvec[i].capacity});
+  } /* for(i..) */
+  return config;
 } /* compute_cluster_placements() */
 
 template<typename TBlockType>
@@ -187,7 +321,12 @@ bool powerlaw_distributor<TBlockType>::map_clusters(cds::arena_grid* const grid)
 
   for (auto& bclustp : config) {
     m_dist_map[bclustp.capacity].emplace_back(
-        bclustp.view, mc_resolution, bclustp.capacity, rng());
+        bclustp.view,
+        grid,
+        mc_resolution,
+        mc_max_block_dims,
+        bclustp.capacity,
+        rng());
   } /* for(i..) */
   for (auto& [clust_size, dist_list] : m_dist_map) {
     ER_INFO("Mapped %zu clusters of capacity %u", dist_list.size(), clust_size);
@@ -215,6 +354,36 @@ ds::block_cluster_vector<TBlockType> powerlaw_distributor<TBlockType>::block_clu
   return ret;
 } /* block_clusters() */
 
+template<typename TBlockType>
+void powerlaw_distributor<TBlockType>::clusters_update_after_drop(
+    const TBlockType* block) {
+  for (auto& l : m_dist_map) {
+    for (auto& dist : l.second) {
+      dist.clusters_update_after_drop(block);
+    } /* for(&dist..) */
+  } /* for(&l..) */
+} /* clusters_update_after_drop() */
+
+template<typename TBlockType>
+void powerlaw_distributor<TBlockType>::clusters_update_after_pickup(
+    const rtypes::type_uuid& id,
+    const rmath::vector2z& coord) {
+  for (auto& l : m_dist_map) {
+    for (auto& dist : l.second) {
+      dist.clusters_update_after_pickup(id, coord);
+    } /* for(&dist..) */
+  } /* for(&l..) */
+} /* clusters_update_after_pickup() */
+
+template<typename TBlockType>
+void powerlaw_distributor<TBlockType>::clusters_recalc(void) {
+  for (auto& l : m_dist_map) {
+    for (auto& dist : l.second) {
+      dist.clusters_recalc();
+    } /* for(&dist..) */
+  } /* for(&l..) */
+} /* clusters_recalc() */
+
 /*******************************************************************************
  * Template Instantiations
  ******************************************************************************/
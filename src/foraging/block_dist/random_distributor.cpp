@@ -24,11 +24,14 @@
 #include "cosm/foraging/block_dist/random_distributor.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <utility>
 
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/arena/operations/free_block_drop.hpp"
 #include "cosm/foraging/utils/utils.hpp"
 #include "cosm/repr/base_block2D.hpp"
+#include "cosm/repr/base_block3D.hpp"
 #include "cosm/repr/unicell_immovable_entity2D.hpp"
 
 /*******************************************************************************
@@ -36,12 +39,20 @@
  ******************************************************************************/
 NS_START(cosm, foraging, block_dist);
 
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+static std::pair<rmath::ranged, rmath::ranged> entity_spans(
+    const crepr::entity_base* ent);
+
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
 template<typename TBlockType>
 random_distributor<TBlockType>::random_distributor(const cds::arena_grid::view& grid,
+                                                   const cds::arena_grid* arena_grid,
                                                    const rtypes::discretize_ratio& resolution,
+                                                   const rmath::vector2d& max_block_dims,
                                                    rmath::rng* rng_in)
     : ER_CLIENT_INIT("cosm.foraging.block_dist.random"),
       base_distributor<TBlockType>(rng_in),
@@ -49,7 +60,9 @@ random_distributor<TBlockType>::random_distributor(const cds::arena_grid::view&
       mc_origin(grid.origin()->loc()),
       mc_xspan(mc_origin.x(), mc_origin.x() + grid.shape()[0]),
       mc_yspan(mc_origin.y(), mc_origin.y() + grid.shape()[1]),
-      m_grid(grid) {
+      mc_arena_grid(arena_grid),
+      m_grid(grid),
+      m_max_block_dims(max_block_dims) {
   ER_INFO("Area: xrange=%s,yrange=%s,resolution=%f",
           mc_xspan.to_str().c_str(),
           mc_yspan.to_str().c_str(),
@@ -67,6 +80,11 @@ bool random_distributor<TBlockType>::distribute_blocks(block_vectorno_type& bloc
           mc_xspan.to_str().c_str(),
           mc_yspan.to_str().c_str());
 
+  /*
+   * Wherever blocks were before is no longer valid, so start from a free list
+   * computed from the entities that are present now.
+   */
+  m_free.clear();
   return std::all_of(blocks.begin(), blocks.end(), [&](auto& b) {
     return distribute_block(b, entities);
   });
@@ -109,7 +127,7 @@ bool random_distributor<TBlockType>::distribute_block(TBlockType* block,
     caops::free_block_drop_visitor<TBlockType> op(
         block, coords->abs, mc_resolution, carena::arena_map_locking::ekALL_HELD);
     op.visit(*cell);
-    if (verify_block_dist(block, entities, cell)) {
+    if (verify_block_dist(block, cell)) {
       ER_DEBUG("Block%d,ptr=%p distributed@%s/%s",
                block->id().v(),
                block,
@@ -135,7 +153,6 @@ bool random_distributor<TBlockType>::distribute_block(TBlockType* block,
 template<typename TBlockType>
 bool random_distributor<TBlockType>::verify_block_dist(
     const TBlockType* const block,
-    const cds::const_entity_vector& entities,
     RCSW_UNUSED const cds::cell2D* const cell) {
   /* blocks should not be out of sight after distribution... */
   ER_CHECK(!block->is_out_of_sight(),
@@ -149,27 +166,12 @@ bool random_distributor<TBlockType>::verify_block_dist(
            block->rloc().to_str().c_str(),
            cell->loc().to_str().c_str());
 
-  /* no entity should overlap with the block after distribution */
-  for (auto& e : entities) {
-    if (e == block) {
-      continue;
-    }
-    utils::placement_status_t status;
-    if (crepr::entity_dimensionality::ek2D == e->dimensionality()) {
-      status = utils::placement_conflict2D(block->rloc2D(),
-                                           block->dims2D(),
-                                           static_cast<const crepr::entity2D*>(e));
-    } else {
-      status = utils::placement_conflict2D(block->rloc2D(),
-                                           block->dims2D(),
-                                           static_cast<const crepr::entity3D*>(e));
-    }
-    ER_ASSERT(!(status.x_conflict && status.y_conflict),
-              "Entity contains block%d@%s/%s after distribution",
-              block->id().v(),
-              block->rloc().to_str().c_str(),
-              block->rloc().to_str().c_str());
-  } /* for(&e..) */
+  /* no block or cache should overlap with the block after distribution */
+  ER_ASSERT(!local_conflict(cell->loc(), block->dims2D(), block),
+            "Entity contains block%d@%s/%s after distribution",
+            block->id().v(),
+            block->rloc().to_str().c_str(),
+            block->dloc().to_str().c_str());
   return true;
 
 error:
@@ -180,52 +182,171 @@ template<typename TBlockType>
 boost::optional<typename random_distributor<TBlockType>::coord_search_res_t> random_distributor<TBlockType>::
     avail_coord_search(const cds::const_entity_vector& entities,
                        const rmath::vector2d& block_dim) {
-  rmath::vector2z rel;
-  rmath::vector2z abs;
-  rcppsw::math::rangeu area_xrange(m_grid.index_bases()[0], m_grid.shape()[0]);
-  rcppsw::math::rangeu area_yrange(m_grid.index_bases()[1], m_grid.shape()[1]);
-
-  /* -1 because we are working with array indices */
-  std::uniform_int_distribution<uint> xdist(area_xrange.lb(),
-                                            area_xrange.ub() - 1);
-  std::uniform_int_distribution<uint> ydist(area_yrange.lb(),
-                                            area_yrange.ub() - 1);
-  uint count = 0;
+  m_max_block_dims = rmath::vector2d(std::max(m_max_block_dims.x(), block_dim.x()),
+                                     std::max(m_max_block_dims.y(), block_dim.y()));
 
   /*
-   * Try to find an available set of relative+absolute coordinates such that if
-   * the entity is placed there it will not overlap any other entities in the
-   * arena. You only have a finite number of tries, for obvious reasons.
+   * The occupancy bitmap is computed for a specific block size, so if we are
+   * distributing a block larger than that we need to recompute it.
    */
-  do {
-    uint x = area_xrange.span() > 0
-                 ? rng()->uniform(area_xrange.lb(), area_xrange.ub() - 1)
-                 : m_grid.index_bases()[0];
-    uint y = area_xrange.span() > 0
-                 ? rng()->uniform(area_yrange.lb(), area_yrange.ub() - 1)
-                 : m_grid.index_bases()[1];
-    rel = {x, y};
-    abs = {rel.x() + mc_origin.x(), rel.y() + mc_origin.y()};
-  } while (std::any_of(entities.begin(), entities.end(), [&](const auto* ent) {
-    rmath::vector2d abs_r = rmath::zvec2dvec(abs, mc_resolution.v());
-    utils::placement_status_t status;
-    if (crepr::entity_dimensionality::ek2D == ent->dimensionality()) {
-      status = utils::placement_conflict2D(abs_r,
-                                           block_dim,
-                                           static_cast<const crepr::entity2D*>(ent));
-    } else {
-      status = utils::placement_conflict2D(abs_r,
-                                           block_dim,
-                                           static_cast<const crepr::entity3D*>(ent));
-    }
-    return status.x_conflict && status.y_conflict && count++ <= kMAX_DIST_TRIES;
-  }));
-  if (count <= kMAX_DIST_TRIES) {
-    return boost::make_optional(coord_search_res_t{rel, abs});
+  bool rebuilt = false;
+  if (m_free.empty() || block_dim.x() > m_occupied_dims.x() ||
+      block_dim.y() > m_occupied_dims.y()) {
+    free_cells_rebuild(entities, block_dim);
+    rebuilt = true;
   }
+
+  /*
+   * Draw candidate cells from the free list until one is found that does not
+   * conflict with any block/cache placed since the list was built. Drawn cells
+   * are always removed: either a block is about to be placed there, or it is
+   * no longer free. If we exhaust the list, it is rebuilt (at most once), as
+   * cells may have become free since it was last built.
+   */
+  while (true) {
+    while (!m_free.empty()) {
+      /* -1 because we are working with array indices */
+      size_t idx = rng()->uniform(0, m_free.size() - 1);
+      rmath::vector2z rel = m_free[idx];
+      m_free[idx] = m_free.back();
+      m_free.pop_back();
+
+      rmath::vector2z abs = {rel.x() + mc_origin.x(), rel.y() + mc_origin.y()};
+      if (!local_conflict(abs, block_dim, nullptr)) {
+        return boost::make_optional(coord_search_res_t{rel, abs});
+      }
+    } /* while(!m_free.empty()) */
+
+    if (rebuilt) {
+      break;
+    }
+    free_cells_rebuild(entities, block_dim);
+    rebuilt = true;
+  } /* while(true) */
   return boost::none;
 } /* avail_coord_search() */
 
+template<typename TBlockType>
+void random_distributor<TBlockType>::free_cells_rebuild(
+    const cds::const_entity_vector& entities,
+    const rmath::vector2d& block_dim) {
+  size_t xsize = m_grid.shape()[0];
+  size_t ysize = m_grid.shape()[1];
+  double res = mc_resolution.v();
+  auto ox = static_cast<long>(mc_origin.x());
+  auto oy = static_cast<long>(mc_origin.y());
+
+  m_occupied_dims = rmath::vector2d(std::max(m_occupied_dims.x(), block_dim.x()),
+                                    std::max(m_occupied_dims.y(), block_dim.y()));
+  m_occupied.assign(xsize * ysize, false);
+
+  /*
+   * Mark every cell in the area at which a block placement would overlap an
+   * entity. Only the cells within the extent of each entity padded by half a
+   * block need to be checked, and entities outside of the area (e.g. blocks
+   * carried by robots) are skipped entirely.
+   */
+  for (auto* ent : entities) {
+    auto spans = entity_spans(ent);
+    long xmin = std::max(
+        0L,
+        static_cast<long>(std::floor(
+            (spans.first.lb() - m_occupied_dims.x() / 2.0) / res)) - ox);
+    long xmax = std::min(
+        static_cast<long>(xsize) - 1,
+        static_cast<long>(std::ceil(
+            (spans.first.ub() + m_occupied_dims.x() / 2.0) / res)) - ox);
+    long ymin = std::max(
+        0L,
+        static_cast<long>(std::floor(
+            (spans.second.lb() - m_occupied_dims.y() / 2.0) / res)) - oy);
+    long ymax = std::min(
+        static_cast<long>(ysize) - 1,
+        static_cast<long>(std::ceil(
+            (spans.second.ub() + m_occupied_dims.y() / 2.0) / res)) - oy);
+
+    for (long i = xmin; i <= xmax; ++i) {
+      for (long j = ymin; j <= ymax; ++j) {
+        auto x = static_cast<size_t>(i);
+        auto y = static_cast<size_t>(j);
+        auto loc = rmath::zvec2dvec(
+            rmath::vector2z(x + mc_origin.x(), y + mc_origin.y()), res);
+        auto status = utils::placement_conflict2D(loc, m_occupied_dims, ent);
+        if (status.x_conflict && status.y_conflict) {
+          m_occupied[x * ysize + y] = true;
+        }
+      } /* for(j..) */
+    } /* for(i..) */
+  } /* for(*ent..) */
+
+  m_free.clear();
+  for (size_t i = 0; i < xsize; ++i) {
+    for (size_t j = 0; j < ysize; ++j) {
+      if (!m_occupied[i * ysize + j]) {
+        m_free.emplace_back(i, j);
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  ER_DEBUG("Rebuilt free cell list: %zu/%zu cells free",
+           m_free.size(),
+           xsize * ysize);
+} /* free_cells_rebuild() */
+
+template<typename TBlockType>
+bool random_distributor<TBlockType>::local_conflict(
+    const rmath::vector2z& abs,
+    const rmath::vector2d& block_dim,
+    const crepr::entity_base* const ignore) const {
+  double res = mc_resolution.v();
+  auto loc = rmath::zvec2dvec(abs, res);
+
+  /*
+   * Blocks are referenced by their host cell, and caches by all cells in their
+   * extent, so only the cells close enough that a block hosted there could
+   * overlap the placement need to be checked. +1 to account for rounding.
+   */
+  auto xreach = static_cast<size_t>(
+      std::ceil((block_dim.x() + m_max_block_dims.x()) / (2.0 * res))) + 1;
+  auto yreach = static_cast<size_t>(
+      std::ceil((block_dim.y() + m_max_block_dims.y()) / (2.0 * res))) + 1;
+  size_t xmin = abs.x() > xreach ? abs.x() - xreach : 0;
+  size_t xmax = std::min(abs.x() + xreach, mc_arena_grid->xdsize() - 1);
+  size_t ymin = abs.y() > yreach ? abs.y() - yreach : 0;
+  size_t ymax = std::min(abs.y() + yreach, mc_arena_grid->ydsize() - 1);
+
+  for (size_t i = xmin; i <= xmax; ++i) {
+    for (size_t j = ymin; j <= ymax; ++j) {
+      const cds::cell2D& cell =
+          mc_arena_grid->access<cds::arena_grid::kCell>(i, j);
+      const crepr::entity_base* ent = cell.entity();
+      if (nullptr == ent || ignore == ent ||
+          !(cell.state_has_block() || cell.state_has_cache() ||
+            cell.state_in_cache_extent())) {
+        continue;
+      }
+      auto status = utils::placement_conflict2D(loc, block_dim, ent);
+      if (status.x_conflict && status.y_conflict) {
+        return true;
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  return false;
+} /* local_conflict() */
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+std::pair<rmath::ranged, rmath::ranged> entity_spans(
+    const crepr::entity_base* const ent) {
+  if (crepr::entity_dimensionality::ek2D == ent->dimensionality()) {
+    auto* ent2D = static_cast<const crepr::entity2D*>(ent);
+    return {ent2D->xspan(), ent2D->yspan()};
+  } else {
+    auto* ent3D = static_cast<const crepr::entity3D*>(ent);
+    return {ent3D->xspan(), ent3D->yspan()};
+  }
+} /* entity_spans() */
+
 /*******************************************************************************
  * Template Instantiations
  ******************************************************************************/
@@ -25,6 +25,7 @@
 
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/base_arena_map.hpp"
+#include "cosm/ds/cell2D.hpp"
 #include "cosm/oracle/config/aggregate_oracle_config.hpp"
 #include "cosm/oracle/entities_oracle.hpp"
 #include "cosm/oracle/tasking_oracle.hpp"
@@ -57,19 +58,26 @@ void foraging_oracle::update(carena::base_arena_map<TBlockType>* const map) {
   auto blocks_it = config()->entities.types.find("blocks");
   if (config()->entities.types.end() != blocks_it && blocks_it->second) {
     coracle::entities_oracle<crepr::base_block2D>::knowledge_type v;
-    /*
-     * Updates to oracle manager can happen in parallel, so we want to make sure
-     * we don't get a set of blocks in a partially updated state. See #594.
-     */
-    std::scoped_lock lock(*map->block_mtx());
+    {
+      /*
+       * Updates to oracle manager can happen in parallel, so we want to make
+       * sure we don't get a set of blocks in a partially updated state. See
+       * #594. The block mutex is taken exclusively, which also excludes tiled
+       * free block drops (see \ref carena::arena_map_locking::ekGRID_TILED),
+       * so the blocks (and their host cells) read below cannot be changing.
+       */
+      std::scoped_lock lock(*map->block_mtx());
+      v.reserve(map->blocks().size());
 
-    std::copy_if(map->blocks().begin(),
-                 map->blocks().end(),
-                 std::back_inserter(v),
-                 [&](const auto& b) {
-                   /* don't include blocks robot's are carrying */
-                   return rtypes::constants::kNoUUID == b->md()->robot_id(); });
-    oracle_get<coracle::entities_oracle<crepr::base_block2D>>(kBlocks)->set_knowledge(v);
+      std::copy_if(map->blocks().begin(),
+                   map->blocks().end(),
+                   std::back_inserter(v),
+                   [&](const auto& b) {
+                     /* don't include blocks robot's are carrying */
+                     return rtypes::constants::kNoUUID == b->md()->robot_id(); });
+    }
+    oracle_get<coracle::entities_oracle<crepr::base_block2D>>(kBlocks)->set_knowledge(
+        std::move(v));
   }
 } /* update() */
 
@@ -77,30 +85,36 @@ void foraging_oracle::update(carena::caching_arena_map* const map) {
   auto blocks_it = config()->entities.types.find("blocks");
   if (config()->entities.types.end() != blocks_it && blocks_it->second) {
     coracle::entities_oracle<crepr::base_block2D>::knowledge_type v;
-    /*
-     * Updates to oracle manager can happen in parallel, so we want to make sure
-     * we don't get a set of blocks in a partially updated state. See #594.
-     */
-    std::scoped_lock lock(*map->block_mtx());
+    {
+      /*
+       * Updates to oracle manager can happen in parallel, so we want to make
+       * sure we don't get a set of blocks in a partially updated state. See
+       * #594. The block mutex is taken exclusively, which also excludes tiled
+       * free block drops (see \ref carena::arena_map_locking::ekGRID_TILED),
+       * so the blocks (and their host cells) read below cannot be changing.
+       */
+      std::scoped_lock lock(*map->block_mtx());
+      v.reserve(map->blocks().size());
 
-    std::copy_if(map->blocks().begin(),
-                 map->blocks().end(),
-                 std::back_inserter(v),
-                 [&](const auto& b) {
-                   /* don't include blocks robot's are carrying */
-                   return rtypes::constants::kNoUUID == b->md()->robot_id() &&
-                       /*
-                        * Don't include blocks that are currently in a cache
-                        * (harmless, but causes repeated "removed block hidden
-                        * behind cache" warnings)
-                        */
-                          std::none_of(map->caches().begin(),
-                                       map->caches().end(),
-                                       [&](const auto& c) {
-                                         return c->contains_block(b);
-                                       });
-                 });
-    oracle_get<coracle::entities_oracle<crepr::base_block2D>>(kBlocks)->set_knowledge(v);
+      std::copy_if(map->blocks().begin(),
+                   map->blocks().end(),
+                   std::back_inserter(v),
+                   [&](const auto& b) {
+                     /* don't include blocks robot's are carrying */
+                     return rtypes::constants::kNoUUID == b->md()->robot_id() &&
+                         /*
+                          * Don't include blocks that are currently in a cache
+                          * (harmless, but causes repeated "removed block hidden
+                          * behind cache" warnings). Blocks in a cache are
+                          * always located on its host cell, and free blocks
+                          * never are, so we only need to check the cell.
+                          */
+                         !map->access<cds::arena_grid::kCell>(b->dloc())
+                              .state_has_cache();
+                   });
+    }
+    oracle_get<coracle::entities_oracle<crepr::base_block2D>>(kBlocks)->set_knowledge(
+        std::move(v));
   }
 
   auto caches_it = config()->entities.types.find("caches");
@@ -110,7 +124,8 @@ void foraging_oracle::update(carena::caching_arena_map* const map) {
     for (auto& c : map->caches()) {
       v.push_back(c);
     } /* for(&b..) */
-    oracle_get<coracle::entities_oracle<carepr::base_cache>>(kCaches)->set_knowledge(v);
+    oracle_get<coracle::entities_oracle<carepr::base_cache>>(kCaches)->set_knowledge(
+        std::move(v));
   }
 } /* update() */
 
@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "cosm/foraging/repr/block_cluster.hpp"
 
+#include <algorithm>
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -32,8 +34,39 @@ NS_START(cosm, foraging, repr);
  * Member Functions
  ******************************************************************************/
 template<typename TBlockType>
-typename block_cluster<TBlockType>::block_vectorro_type block_cluster<TBlockType>::blocks(void) const {
-  block_vectorro_type ret;
+void block_cluster<TBlockType>::update_after_drop(const TBlockType* const block) {
+  auto coord = block->dloc2D();
+  if (!contains_cell(coord)) {
+    return;
+  }
+  auto& cell = block_cluster::cell(static_cast<uint>(coord.x() - dloc2D().x()),
+                                   static_cast<uint>(coord.y() - dloc2D().y()));
+  if (!cell.state_has_block() || cell.entity() != block) {
+    return;
+  }
+  if (m_blocks.end() == std::find(m_blocks.begin(), m_blocks.end(), block)) {
+    m_blocks.push_back(block);
+  }
+} /* update_after_drop() */
+
+template<typename TBlockType>
+void block_cluster<TBlockType>::update_after_pickup(const rtypes::type_uuid& id,
+                                                    const rmath::vector2z& coord) {
+  if (!contains_cell(coord)) {
+    return;
+  }
+  auto it = std::find_if(m_blocks.begin(), m_blocks.end(), [&](const auto* b) {
+    return b->id() == id;
+  });
+  if (m_blocks.end() != it) {
+    *it = m_blocks.back();
+    m_blocks.pop_back();
+  }
+} /* update_after_pickup() */
+
+template<typename TBlockType>
+void block_cluster<TBlockType>::blocks_recalc(void) {
+  m_blocks.clear();
   for (uint i = 0; i < xdimd(); ++i) {
     for (uint j = 0; j < ydimd(); ++j) {
       auto& cell = block_cluster::cell(i, j);
@@ -43,25 +76,23 @@ typename block_cluster<TBlockType>::block_vectorro_type block_cluster<TBlockType
       ER_ASSERT(!cell.state_in_cache_extent(),
                 "Cell@%s in CACHE_EXTENT state",
                 cell.loc().to_str().c_str());
+      if (!cell.state_has_block()) {
+        continue;
+      }
       if constexpr (std::is_same<TBlockType, crepr::base_block2D>::value) {
-          if (cell.state_has_block()) {
-            ER_ASSERT(nullptr != cell.block2D(),
-                      "Cell@%s null block2D",
-                      cell.loc().to_str().c_str());
-            ret.push_back(cell.block2D());
-          }
-        } else if constexpr (std::is_same<TBlockType, crepr::base_block2D>::value) {
-          if (cell.state_has_block()) {
-            ER_ASSERT(nullptr != cell.block3D(),
-                      "Cell@%s null block3D",
-                      cell.loc().to_str().c_str());
-            ret.push_back(cell.block3D());
-          }
-        }
+        ER_ASSERT(nullptr != cell.block2D(),
+                  "Cell@%s null block2D",
+                  cell.loc().to_str().c_str());
+        m_blocks.push_back(cell.block2D());
+      } else {
+        ER_ASSERT(nullptr != cell.block3D(),
+                  "Cell@%s null block3D",
+                  cell.loc().to_str().c_str());
+        m_blocks.push_back(cell.block3D());
+      }
     } /* for(j..) */
   }   /* for(i..) */
-  return ret;
-} /* blocks() */
+} /* blocks_recalc() */
 
 /*******************************************************************************
  * Template Instantiations
@@ -23,6 +23,8 @@
  *****************************************************************************/
 #include "cosm/foraging/repr/foraging_los.hpp"
 
+#include <unordered_set>
+
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 
@@ -34,78 +36,86 @@ NS_START(cosm, foraging, repr);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-cds::entity_vector foraging_los::blocks(void) const {
-  cds::entity_vector blocks{};
+template<typename TFunc>
+void foraging_los::cells_visit(const TFunc& f) const {
+  const cds::cell2D* origin = m_view->origin();
+  auto xstride = m_view->strides()[0];
+  auto ystride = m_view->strides()[1];
+
   for (uint i = 0; i < xsize(); ++i) {
+    const cds::cell2D* row = origin + i * xstride;
     for (uint j = 0; j < ysize(); ++j) {
-      const cds::cell2D& cell = mc_view[i][j];
-      if (cell.state_has_block()) {
-        ER_ASSERT(nullptr != cell.block2D() || nullptr != cell.block3D(),
-                  "Cell at(%u,%u) in HAS_BLOCK state, but does not have block",
-                  i,
-                  j);
-        blocks.push_back(cell.entity());
-      }
+      f(row[j * ystride], i, j);
     } /* for(j..) */
   }   /* for(i..) */
+} /* cells_visit() */
+
+cds::entity_vector foraging_los::blocks(void) const {
+  cds::entity_vector blocks{};
+  cells_visit([&](const cds::cell2D& cell,
+                  RCSW_UNUSED uint i,
+                  RCSW_UNUSED uint j) {
+    if (cell.state_has_block()) {
+      ER_ASSERT(nullptr != cell.block2D() || nullptr != cell.block3D(),
+                "Cell at(%u,%u) in HAS_BLOCK state, but does not have block",
+                i,
+                j);
+      blocks.push_back(cell.entity());
+    }
+  });
   return blocks;
 } /* blocks() */
 
 cads::bcache_vectorno foraging_los::caches(void) const {
   cads::bcache_vectorno caches;
 
-  for (uint i = 0; i < xsize(); ++i) {
-    for (uint j = 0; j < ysize(); ++j) {
-      const cds::cell2D& cell = mc_view[i][j];
-      if (cell.state_has_cache() || cell.state_in_cache_extent()) {
-        auto cache = cell.cache();
-        ER_ASSERT(
-            nullptr != cache,
-            "Cell@%s in HAS_CACHE/CACHE_EXTENT state, but does not have cache",
-            cell.loc().to_str().c_str());
-        ER_ASSERT(cache->n_blocks() >= carepr::base_cache::kMinBlocks,
-                  "Cache%d@%s has too few blocks (%zu < %zu)",
-                  cache->id().v(),
-                  cache->dloc().to_str().c_str(),
-                  cache->n_blocks(),
-                  carepr::base_cache::kMinBlocks);
-        /*
-         * We can't add the cache unconditionally, because cache host cells and
-         * extent cells both refer to the same cache, and doing so will give you
-         * double references to a single cache in a LOS, which can cause
-         * problems with pheromone updating. See #433.
-         */
-        if (caches.end() == std::find(caches.begin(), caches.end(), cache)) {
-          caches.push_back(cache);
-        }
-      }
-    } /* for(j..) */
-  }   /* for(i..) */
+  /*
+   * We can't add caches unconditionally, because cache host cells and extent
+   * cells both refer to the same cache, and doing so will give you double
+   * references to a single cache in a LOS, which can cause problems with
+   * pheromone updating. See #433.
+   */
+  std::unordered_set<const carepr::base_cache*> seen;
 
+  cells_visit([&](const cds::cell2D& cell, uint, uint) {
+    if (!cell.state_has_cache() && !cell.state_in_cache_extent()) {
+      return;
+    }
+    auto cache = cell.cache();
+    ER_ASSERT(
+        nullptr != cache,
+        "Cell@%s in HAS_CACHE/CACHE_EXTENT state, but does not have cache",
+        cell.loc().to_str().c_str());
+    ER_ASSERT(cache->n_blocks() >= carepr::base_cache::kMinBlocks,
+              "Cache%d@%s has too few blocks (%zu < %zu)",
+              cache->id().v(),
+              cache->dloc().to_str().c_str(),
+              cache->n_blocks(),
+              carepr::base_cache::kMinBlocks);
+    if (seen.insert(cache).second) {
+      caches.push_back(cache);
+    }
+  });
   return caches;
 } /* caches() */
 
 bool foraging_los::contains_loc(const rmath::vector2z& loc) const {
-  for (size_t i = 0; i < xsize(); ++i) {
-    for (size_t j = 0; j < ysize(); ++j) {
-      if (cell(i, j).loc() == loc) {
-        return true;
-      }
-    } /* for(j..) */
-  }   /* for(i..) */
-  return false;
+  auto ll = abs_ll();
+  auto ur = abs_ur();
+  return loc.x() >= ll.x() && loc.x() <= ur.x() && loc.y() >= ll.y() &&
+         loc.y() <= ur.y();
 } /* contains_loc() */
 
 const cds::cell2D& foraging_los::cell(uint i, uint j) const {
-  ER_ASSERT(i < mc_view.shape()[0],
+  ER_ASSERT(i < m_view->shape()[0],
             "Out of bounds X access: %u >= %lu",
             i,
-            mc_view.shape()[0]);
-  ER_ASSERT(j < mc_view.shape()[1],
+            m_view->shape()[0]);
+  ER_ASSERT(j < m_view->shape()[1],
             "Out of bounds Y access: %u >= %lu",
             j,
-            mc_view.shape()[1]);
-  return mc_view[i][j];
+            m_view->shape()[1]);
+  return (*m_view)[i][j];
 }
 
 rmath::vector2z foraging_los::abs_ll(void) const {
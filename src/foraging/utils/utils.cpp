@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include "cosm/foraging/utils/utils.hpp"
 #include "cosm/repr/entity2D.hpp"
+#include "cosm/repr/entity3D.hpp"
 #include "cosm/arena/base_arena_map.hpp"
 #include "cosm/foraging/repr/foraging_los.hpp"
 
@@ -52,6 +53,20 @@ placement_status_t placement_conflict2D(const rmath::vector2d& ent1_loc,
                             entity->yspan().overlaps_with(loc_yspan)};
 } /* placement_conflict2D() */
 
+placement_status_t placement_conflict2D(const rmath::vector2d& ent1_loc,
+                                        const rmath::vector2d& ent1_dims,
+                                        const crepr::entity_base* const entity) {
+  if (crepr::entity_dimensionality::ek2D == entity->dimensionality()) {
+    return placement_conflict2D(ent1_loc,
+                                ent1_dims,
+                                static_cast<const crepr::entity2D*>(entity));
+  } else {
+    return placement_conflict2D(ent1_loc,
+                                ent1_dims,
+                                static_cast<const crepr::entity3D*>(entity));
+  }
+} /* placement_conflict2D() */
+
 template<typename TBlockType>
 std::unique_ptr<cfrepr::foraging_los> compute_robot_los(
     const carena::base_arena_map<TBlockType>& map,
@@ -45,7 +45,20 @@ collision_metrics_collector::collision_metrics_collector(
  ******************************************************************************/
 std::list<std::string> collision_metrics_collector::csv_header_cols(void) const {
   auto merged = dflt_csv_header_cols();
-  auto cols = std::list<std::string>{
+  auto cols = data_cols();
+  merged.splice(merged.end(), cols);
+  return merged;
+} /* csv_header_cols() */
+
+std::vector<std::string> collision_metrics_collector::binary_cols(void) const {
+  auto cols = data_cols();
+  std::vector<std::string> ret = {"clock"};
+  ret.insert(ret.end(), cols.begin(), cols.end());
+  return ret;
+} /* binary_cols() */
+
+std::list<std::string> collision_metrics_collector::data_cols(void) const {
+  return {
       /* clang-format off */
     "int_avg_in_avoidance",
     "cum_avg_in_avoidance",
@@ -57,9 +70,7 @@ std::list<std::string> collision_metrics_collector::csv_header_cols(void) const
     "cum_avg_avoidance_duration"
       /* clang-format on */
   };
-  merged.splice(merged.end(), cols);
-  return merged;
-} /* csv_header_cols() */
+} /* data_cols() */
 
 void collision_metrics_collector::reset(void) {
   base_metrics_collector::reset();
@@ -90,6 +101,19 @@ boost::optional<std::string> collision_metrics_collector::csv_line_build(void) {
   if (!(timestep() % interval() == 0)) {
     return boost::none;
   }
+  if (binary_output_enabled()) {
+    binary_row_append(
+        static_cast<double>(timestep().v()),
+        binary_avg(m_interval.n_in_avoidance.load(), interval().v()),
+        binary_avg(m_cum.n_in_avoidance.load(), timestep().v()),
+        binary_avg(m_interval.n_entered_avoidance.load(), interval().v()),
+        binary_avg(m_cum.n_entered_avoidance.load(), timestep().v()),
+        binary_avg(m_interval.n_exited_avoidance.load(), interval().v()),
+        binary_avg(m_cum.n_exited_avoidance.load(), timestep().v()),
+        binary_avg(m_interval.avoidance_duration.load(), interval().v()),
+        binary_avg(m_cum.avoidance_duration.load(), timestep().v()));
+    return boost::none;
+  }
   std::string line;
 
   line += csv_entry_intavg(m_interval.n_in_avoidance.load());
@@ -105,10 +129,10 @@ boost::optional<std::string> collision_metrics_collector::csv_line_build(void) {
 } /* csv_line_build() */
 
 void collision_metrics_collector::reset_after_interval(void) {
-  m_interval.n_in_avoidance = 0;
-  m_interval.n_entered_avoidance = 0;
-  m_interval.n_exited_avoidance = 0;
-  m_interval.avoidance_duration = 0;
+  m_interval.n_in_avoidance.reset();
+  m_interval.n_entered_avoidance.reset();
+  m_interval.n_exited_avoidance.reset();
+  m_interval.avoidance_duration.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, fsm, cosm);
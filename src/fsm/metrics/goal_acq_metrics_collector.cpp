@@ -45,7 +45,20 @@ goal_acq_metrics_collector::goal_acq_metrics_collector(
  ******************************************************************************/
 std::list<std::string> goal_acq_metrics_collector::csv_header_cols(void) const {
   auto merged = dflt_csv_header_cols();
-  auto cols = std::list<std::string>{
+  auto cols = data_cols();
+  merged.splice(merged.end(), cols);
+  return merged;
+} /* csv_header_cols() */
+
+std::vector<std::string> goal_acq_metrics_collector::binary_cols(void) const {
+  auto cols = data_cols();
+  std::vector<std::string> ret = {"clock"};
+  ret.insert(ret.end(), cols.begin(), cols.end());
+  return ret;
+} /* binary_cols() */
+
+std::list<std::string> goal_acq_metrics_collector::data_cols(void) const {
+  return {
       /* clang-format off */
     "int_avg_acquiring_goal",
     "cum_avg_acquiring_goal",
@@ -57,9 +70,7 @@ std::list<std::string> goal_acq_metrics_collector::csv_header_cols(void) const {
     "cum_avg_false_exploring_for_goal",
       /* clang-format on */
   };
-  merged.splice(merged.end(), cols);
-  return merged;
-} /* csv_header_cols() */
+} /* data_cols() */
 
 void goal_acq_metrics_collector::reset(void) {
   base_metrics_collector::reset();
@@ -88,6 +99,19 @@ boost::optional<std::string> goal_acq_metrics_collector::csv_line_build(void) {
   if (!(timestep() % interval() == 0)) {
     return boost::none;
   }
+  if (binary_output_enabled()) {
+    binary_row_append(
+        static_cast<double>(timestep().v()),
+        binary_avg(m_interval.n_acquiring_goal.load(), interval().v()),
+        binary_avg(m_cum.n_acquiring_goal.load(), timestep().v()),
+        binary_avg(m_interval.n_vectoring_to_goal.load(), interval().v()),
+        binary_avg(m_cum.n_vectoring_to_goal.load(), timestep().v()),
+        binary_avg(m_interval.n_true_exploring_for_goal.load(), interval().v()),
+        binary_avg(m_cum.n_true_exploring_for_goal.load(), timestep().v()),
+        binary_avg(m_interval.n_false_exploring_for_goal.load(), interval().v()),
+        binary_avg(m_cum.n_false_exploring_for_goal.load(), timestep().v()));
+    return boost::none;
+  }
   std::string line;
 
   line += csv_entry_intavg(m_interval.n_acquiring_goal.load());
@@ -103,10 +127,10 @@ boost::optional<std::string> goal_acq_metrics_collector::csv_line_build(void) {
 } /* store_foraging_stats() */
 
 void goal_acq_metrics_collector::reset_after_interval(void) {
-  m_interval.n_true_exploring_for_goal = 0;
-  m_interval.n_false_exploring_for_goal = 0;
-  m_interval.n_acquiring_goal = 0;
-  m_interval.n_vectoring_to_goal = 0;
+  m_interval.n_true_exploring_for_goal.reset();
+  m_interval.n_false_exploring_for_goal.reset();
+  m_interval.n_acquiring_goal.reset();
+  m_interval.n_vectoring_to_goal.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, fsm, cosm);
@@ -45,7 +45,20 @@ movement_metrics_collector::movement_metrics_collector(
  ******************************************************************************/
 std::list<std::string> movement_metrics_collector::csv_header_cols(void) const {
   auto merged = dflt_csv_header_cols();
-  auto cols = std::list<std::string>{
+  auto cols = data_cols();
+  merged.splice(merged.end(), cols);
+  return merged;
+} /* csv_header_cols() */
+
+std::vector<std::string> movement_metrics_collector::binary_cols(void) const {
+  auto cols = data_cols();
+  std::vector<std::string> ret = {"clock"};
+  ret.insert(ret.end(), cols.begin(), cols.end());
+  return ret;
+} /* binary_cols() */
+
+std::list<std::string> movement_metrics_collector::data_cols(void) const {
+  return {
       /* clang-format off */
     "int_avg_distance",
     "cum_avg_distance",
@@ -53,9 +66,7 @@ std::list<std::string> movement_metrics_collector::csv_header_cols(void) const {
     "cum_avg_velocity"
       /* clang-format on */
   };
-  merged.splice(merged.end(), cols);
-  return merged;
-} /* csv_header_cols() */
+} /* data_cols() */
 
 void movement_metrics_collector::reset(void) {
   base_metrics_collector::reset();
@@ -66,13 +77,26 @@ boost::optional<std::string> movement_metrics_collector::csv_line_build(void) {
   if (!(timestep() % interval() == 0)) {
     return boost::none;
   }
+  if (binary_output_enabled()) {
+    binary_row_append(
+        static_cast<double>(timestep().v()),
+        binary_avg(m_interval.distance.load(), m_interval.robot_count.load()),
+        binary_avg(m_cum.distance.load(), m_cum.robot_count.load()),
+        binary_avg(m_interval.velocity.load(), m_interval.robot_count.load()),
+        binary_avg(m_cum.velocity.load(), m_cum.robot_count.load()));
+    return boost::none;
+  }
   std::string line;
 
-  line += csv_entry_domavg(m_interval.distance.load(), m_interval.robot_count);
-  line += csv_entry_domavg(m_cum.distance.load(), m_cum.robot_count);
+  line += csv_entry_domavg(m_interval.distance.load(),
+                           m_interval.robot_count.load());
+  line += csv_entry_domavg(m_cum.distance.load(), m_cum.robot_count.load());
 
-  line += csv_entry_domavg(m_interval.velocity.load(), m_interval.robot_count);
-  line += csv_entry_domavg(m_cum.velocity.load(), m_cum.robot_count, true);
+  line += csv_entry_domavg(m_interval.velocity.load(),
+                           m_interval.robot_count.load());
+  line += csv_entry_domavg(m_cum.velocity.load(),
+                           m_cum.robot_count.load(),
+                           true);
   return boost::make_optional(line);
 } /* csv_line_build() */
 
@@ -80,23 +104,16 @@ void movement_metrics_collector::collect(const rmetrics::base_metrics& metrics)
   auto& m = dynamic_cast<const movement_metrics&>(metrics);
   ++m_interval.robot_count;
   ++m_cum.robot_count;
-  auto cum_dist = m_cum.distance.load();
-  auto int_dist = m_interval.distance.load();
-  auto cum_vel = m_cum.velocity.load();
-  auto int_vel = m_interval.velocity.load();
-  m_cum.distance.compare_exchange_strong(cum_dist, cum_dist + m.distance().v());
-  m_interval.distance.compare_exchange_strong(int_dist,
-                                              int_dist + m.distance().v());
-  m_cum.velocity.compare_exchange_strong(cum_vel,
-                                         cum_vel + m.velocity().length());
-  m_interval.velocity.compare_exchange_strong(int_vel,
-                                              int_vel + m.velocity().length());
+  m_cum.distance += m.distance().v();
+  m_interval.distance += m.distance().v();
+  m_cum.velocity += m.velocity().length();
+  m_interval.velocity += m.velocity().length();
 } /* collect() */
 
 void movement_metrics_collector::reset_after_interval(void) {
-  m_interval.distance = 0.0;
-  m_interval.velocity = 0.0;
-  m_interval.robot_count = 0;
+  m_interval.distance.reset();
+  m_interval.velocity.reset();
+  m_interval.robot_count.reset();
 } /* reset_after_interval() */
 
 NS_END(metrics, fsm, cosm);
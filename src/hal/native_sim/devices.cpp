@@ -0,0 +1,129 @@
+/**
+ * \file devices.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/hal/native_sim/devices.hpp"
+
+#include <algorithm>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, hal, native_sim);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+const std::vector<proximity_sensor::reading>& proximity_sensor::readings(
+    void) const {
+  const auto* config = sim()->config();
+  double body = config->robot_radius;
+  m_readings.clear();
+
+  sim()->walls_visit(robot_id(),
+                     body + config->prox_range,
+                     [&](double dist, double angle) {
+                       double gap = std::max(0.0, dist - body);
+                       m_readings.push_back({1.0 - gap / config->prox_range,
+                                             relative(angle)});
+                     });
+  sim()->neighbors_visit(
+      robot_id(),
+      2 * body + config->prox_range,
+      [&](size_t, double dist, double angle) {
+        double gap = std::max(0.0, dist - 2 * body);
+        m_readings.push_back({1.0 - gap / config->prox_range, relative(angle)});
+      });
+  return m_readings;
+} /* readings() */
+
+const std::vector<light_sensor::reading>& light_sensor::readings(void) const {
+  m_readings.clear();
+  if (!m_enabled) {
+    return m_readings;
+  }
+  double range = sim()->config()->light_range;
+  for (auto& light : sim()->lights()) {
+    auto diff = light - state().pos;
+    double dist = diff.length();
+    if (dist <= range) {
+      m_readings.push_back(
+          {1.0 - dist / range, relative(std::atan2(diff.y(), diff.x()))});
+    }
+  } /* for(&light..) */
+  return m_readings;
+} /* readings() */
+
+const std::vector<ground_sensor::reading>& ground_sensor::readings(void) const {
+  double dist = sim()->config()->robot_radius * 0.75;
+  m_readings.clear();
+  for (double offset : {M_PI / 4, 3 * M_PI / 4, -3 * M_PI / 4, -M_PI / 4}) {
+    double angle = state().heading + offset;
+    auto pos = state().pos + rmath::vector2d(dist * std::cos(angle),
+                                             dist * std::sin(angle));
+    m_readings.push_back({sim()->floor_value(pos), dist});
+  } /* for(offset..) */
+  return m_readings;
+} /* readings() */
+
+const std::vector<colored_blob_camera_sensor::reading>&
+colored_blob_camera_sensor::readings(void) const {
+  m_readings.clear();
+  if (!m_enabled) {
+    return m_readings;
+  }
+  sim()->neighbors_visit(robot_id(),
+                         sim()->config()->camera_range,
+                         [&](size_t other, double dist, double angle) {
+                           auto& color = sim()->robot(other).led_visible;
+                           if (0 == color.red() && 0 == color.green() &&
+                               0 == color.blue()) {
+                             return;
+                           }
+                           m_readings.push_back({dist, relative(angle), color});
+                         });
+  return m_readings;
+} /* readings() */
+
+wifi_sensor::reading_range wifi_sensor::readings(void) const {
+  /*
+   * Payload buffers past the current count are kept rather than destroyed, so
+   * that their storage is reused when more robots come into range again.
+   */
+  m_n_readings = 0;
+  sim()->neighbors_visit(robot_id(),
+                         sim()->config()->wifi_range,
+                         [&](size_t other, double, double) {
+                           auto& data = sim()->robot(other).wifi_visible;
+                           if (data.empty()) {
+                             return;
+                           }
+                           if (m_n_readings == m_readings.size()) {
+                             m_readings.emplace_back();
+                           }
+                           m_readings[m_n_readings++].assign(data.begin(),
+                                                             data.end());
+                         });
+  return { m_readings.cbegin(), m_readings.cbegin() + m_n_readings };
+} /* readings() */
+
+NS_END(native_sim, hal, cosm);
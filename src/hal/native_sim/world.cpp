@@ -0,0 +1,155 @@
+/**
+ * \file world.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/hal/native_sim/world.hpp"
+
+#include <algorithm>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(cosm, hal, native_sim);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+world::world(const config::world_config* config, const cds::arena_grid* grid)
+    : ER_CLIENT_INIT("cosm.hal.native_sim.world"),
+      mc_config(*config),
+      mc_grid(grid),
+      m_floor(grid->xdsize() * grid->ydsize(), config->floor_value),
+      m_bucket_dim(std::max({config->prox_range + 2 * config->robot_radius,
+                             config->camera_range,
+                             config->wifi_range})),
+      m_xbuckets(static_cast<size_t>(grid->xrsize() / m_bucket_dim) + 1),
+      m_ybuckets(static_cast<size_t>(grid->yrsize() / m_bucket_dim) + 1) {
+  ER_ASSERT(mc_config.dt > 0.0, "Step length must be > 0");
+  ER_ASSERT(m_bucket_dim > 0.0, "Sensing ranges must be > 0");
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+size_t world::robot_add(const rmath::vector2d& pos, double heading) {
+  robot_state robot;
+  robot.pos = pos;
+  robot.heading = heading;
+  m_robots.push_back(robot);
+  m_buckets_dirty = true;
+  return m_robots.size() - 1;
+} /* robot_add() */
+
+void world::floor_fill(const rmath::vector2z& ll,
+                       const rmath::vector2z& ur,
+                       double value) {
+  ER_ASSERT(ur.x() < mc_grid->xdsize() && ur.y() < mc_grid->ydsize(),
+            "Fill region out of bounds");
+  for (size_t i = ll.x(); i <= ur.x(); ++i) {
+    for (size_t j = ll.y(); j <= ur.y(); ++j) {
+      m_floor[i * mc_grid->ydsize() + j] = value;
+    } /* for(j..) */
+  } /* for(i..) */
+} /* floor_fill() */
+
+double world::floor_value(const rmath::vector2d& pos) const {
+  if (pos.x() < 0.0 || pos.y() < 0.0) {
+    return mc_config.floor_value;
+  }
+  auto i = static_cast<size_t>(pos.x() / mc_grid->resolution().v());
+  auto j = static_cast<size_t>(pos.y() / mc_grid->resolution().v());
+  if (i >= mc_grid->xdsize() || j >= mc_grid->ydsize()) {
+    return mc_config.floor_value;
+  }
+  return m_floor[i * mc_grid->ydsize() + j];
+} /* floor_value() */
+
+void world::run(size_t n_steps, const control_step_cb_type& control_step) {
+  for (size_t s = 0; s < n_steps; ++s) {
+    buckets_update();
+#pragma omp parallel for num_threads(mc_config.n_threads)
+    for (size_t i = 0; i < m_robots.size(); ++i) {
+      control_step(i);
+    } /* for(i..) */
+    step();
+  } /* for(s..) */
+} /* run() */
+
+void world::step(void) {
+  double dt = mc_config.dt;
+  double rmin = mc_config.robot_radius;
+  double xmax = std::max(rmin, mc_grid->xrsize() - mc_config.robot_radius);
+  double ymax = std::max(rmin, mc_grid->yrsize() - mc_config.robot_radius);
+
+#pragma omp parallel for num_threads(mc_config.n_threads)
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    auto& robot = m_robots[i];
+    double v = (robot.vel_left + robot.vel_right) / 2.0;
+    double w = (robot.vel_right - robot.vel_left) / mc_config.axle_length;
+
+    /* midpoint integration of the unicycle model */
+    double mid = robot.heading + w * dt / 2.0;
+    double x = robot.pos.x() + v * dt * std::cos(mid);
+    double y = robot.pos.y() + v * dt * std::sin(mid);
+    robot.pos = rmath::vector2d(std::clamp(x, rmin, xmax),
+                                std::clamp(y, rmin, ymax));
+    robot.heading = std::remainder(robot.heading + w * dt, 2 * M_PI);
+    robot.dist_left = robot.vel_left * dt;
+    robot.dist_right = robot.vel_right * dt;
+
+    robot.led_visible = robot.led;
+    robot.wifi_visible = robot.wifi_data;
+  } /* for(i..) */
+
+  m_buckets_dirty = true;
+  ++m_steps;
+} /* step() */
+
+std::pair<long, long> world::bucket_of(const rmath::vector2d& pos) const {
+  auto i = std::min(static_cast<size_t>(std::max(pos.x(), 0.0) / m_bucket_dim),
+                    m_xbuckets - 1);
+  auto j = std::min(static_cast<size_t>(std::max(pos.y(), 0.0) / m_bucket_dim),
+                    m_ybuckets - 1);
+  return {static_cast<long>(i), static_cast<long>(j)};
+} /* bucket_of() */
+
+void world::buckets_rebuild(void) {
+  /* assign()/resize() do not reallocate once the robot count is stable */
+  m_robot_buckets.resize(m_robots.size());
+  m_bucket_starts.assign(m_xbuckets * m_ybuckets + 1, 0);
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    auto b = bucket_of(m_robots[i].pos);
+    m_robot_buckets[i] = static_cast<size_t>(b.first) * m_ybuckets +
+                         static_cast<size_t>(b.second);
+    ++m_bucket_starts[m_robot_buckets[i] + 1];
+  } /* for(i..) */
+  for (size_t b = 1; b < m_bucket_starts.size(); ++b) {
+    m_bucket_starts[b] += m_bucket_starts[b - 1];
+  } /* for(b..) */
+  m_bucket_ids.resize(m_robots.size());
+  m_bucket_fill.assign(m_bucket_starts.begin(), m_bucket_starts.end() - 1);
+  for (size_t i = 0; i < m_robots.size(); ++i) {
+    m_bucket_ids[m_bucket_fill[m_robot_buckets[i]]++] = i;
+  } /* for(i..) */
+} /* buckets_rebuild() */
+
+NS_END(native_sim, hal, cosm);
@@ -0,0 +1,224 @@
+/**
+ * \file binary_sink.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cosm/metrics/binary_sink.hpp"
+
+#include <cstring>
+#include <limits>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(cosm, metrics);
+
+/*******************************************************************************
+ * Constructors/Destructors
+ ******************************************************************************/
+binary_sink::binary_sink(const std::string& fpath,
+                         const std::vector<std::string>& cols,
+                         const rmetrics::output_mode& mode)
+    : ER_CLIENT_INIT("cosm.metrics.binary_sink"),
+      mc_n_cols(cols.size()) {
+  auto header = header_build(cols);
+
+  /*
+   * As with .csv output, appending continues an existing file rather than
+   * replacing it. Blocks are self-describing, so appended blocks can simply
+   * follow the existing ones, as long as the columns are the same.
+   */
+  bool append = rmetrics::output_mode::ekAPPEND == mode &&
+                header_matches(fpath, header);
+  m_ofs.open(fpath,
+             std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+  ER_ASSERT(m_ofs.is_open(), "Unable to open '%s'", fpath.c_str());
+  if (!append) {
+    m_ofs.write(header.data(), static_cast<std::streamsize>(header.size()));
+  }
+
+  m_fill.values.resize(mc_n_cols * kBlockRows);
+  m_writer = std::thread(&binary_sink::writer_main, this);
+}
+
+binary_sink::~binary_sink(void) {
+  flush();
+  {
+    std::scoped_lock lock(m_mtx);
+    m_done = true;
+  }
+  m_cv.notify_all();
+  m_writer.join();
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void binary_sink::row_append(const std::vector<double>& row) {
+  ER_ASSERT(row.size() == mc_n_cols,
+            "Bad row size: %zu != %zu",
+            row.size(),
+            mc_n_cols);
+  for (size_t i = 0; i < mc_n_cols; ++i) {
+    m_fill.values[i * kBlockRows + m_fill.n_rows] = row[i];
+  } /* for(i..) */
+
+  if (++m_fill.n_rows < kBlockRows) {
+    return;
+  }
+  /* block full--hand it to the writer and start filling a recycled one */
+  {
+    std::scoped_lock lock(m_mtx);
+    m_full.push_back(std::move(m_fill));
+    if (!m_free.empty()) {
+      m_fill = std::move(m_free.back());
+      m_free.pop_back();
+    } else {
+      m_fill = block{};
+    }
+  }
+  m_cv.notify_all();
+  m_fill.values.resize(mc_n_cols * kBlockRows);
+  m_fill.n_rows = 0;
+} /* row_append() */
+
+void binary_sink::flush(void) {
+  std::unique_lock lock(m_mtx);
+  if (m_fill.n_rows > 0) {
+    m_full.push_back(std::move(m_fill));
+    m_fill = block{};
+    m_fill.values.resize(mc_n_cols * kBlockRows);
+    m_cv.notify_all();
+  }
+  m_cv.wait(lock, [&] { return m_full.empty() && !m_writing; });
+  m_ofs.flush();
+} /* flush() */
+
+std::string binary_sink::header_build(const std::vector<std::string>& cols) {
+  std::string header(kMagic);
+  auto append = [&](const auto& v) {
+    header.append(reinterpret_cast<const char*>(&v), sizeof(v));
+  };
+  append(static_cast<uint32_t>(cols.size()));
+  for (auto& col : cols) {
+    append(column_type::ekFLOAT64);
+    append(static_cast<uint32_t>(col.size()));
+    header += col;
+  } /* for(&col..) */
+  return header;
+} /* header_build() */
+
+bool binary_sink::header_matches(const std::string& fpath,
+                                 const std::string& header) {
+  std::ifstream ifs(fpath, std::ios::binary);
+  std::string existing(header.size(), '\0');
+  return ifs.read(existing.data(), static_cast<std::streamsize>(existing.size())) &&
+         existing == header;
+} /* header_matches() */
+
+void binary_sink::writer_main(void) {
+  std::unique_lock lock(m_mtx);
+  while (true) {
+    m_cv.wait(lock, [&] { return m_done || !m_full.empty(); });
+    if (m_full.empty()) { /* done, and nothing left to write */
+      return;
+    }
+    block b = std::move(m_full.front());
+    m_full.pop_front();
+    m_writing = true;
+
+    lock.unlock();
+    block_write(b);
+    lock.lock();
+
+    b.n_rows = 0;
+    m_free.push_back(std::move(b));
+    m_writing = false;
+    m_cv.notify_all();
+  } /* while(true) */
+} /* writer_main() */
+
+void binary_sink::block_write(const block& b) {
+  auto n_rows = static_cast<uint32_t>(b.n_rows);
+  m_ofs.write(reinterpret_cast<const char*>(&n_rows), sizeof(n_rows));
+
+  /*
+   * Blocks are always allocated for kBlockRows rows, so for partial blocks we
+   * only write the filled part of each column.
+   */
+  for (size_t i = 0; i < mc_n_cols; ++i) {
+    m_ofs.write(reinterpret_cast<const char*>(&b.values[i * kBlockRows]),
+                static_cast<std::streamsize>(n_rows * sizeof(double)));
+  } /* for(i..) */
+} /* block_write() */
+
+bool binary_sink::to_csv(const std::string& bin_path,
+                         const std::string& csv_path,
+                         const std::string& separator) {
+  std::ifstream ifs(bin_path, std::ios::binary);
+  std::ofstream ofs(csv_path, std::ios::trunc);
+  if (!ifs.is_open() || !ofs.is_open()) {
+    return false;
+  }
+  ofs.precision(std::numeric_limits<double>::max_digits10);
+
+  char magic[sizeof(kMagic) - 1];
+  ifs.read(magic, sizeof(magic));
+  if (!ifs || 0 != std::memcmp(magic, kMagic, sizeof(magic))) {
+    return false;
+  }
+
+  /* header */
+  uint32_t n_cols = 0;
+  ifs.read(reinterpret_cast<char*>(&n_cols), sizeof(n_cols));
+  for (uint32_t i = 0; i < n_cols && ifs; ++i) {
+    column_type type;
+    uint32_t len = 0;
+    ifs.read(reinterpret_cast<char*>(&type), sizeof(type));
+    ifs.read(reinterpret_cast<char*>(&len), sizeof(len));
+    std::string name(len, '\0');
+    ifs.read(name.data(), len);
+    if (column_type::ekFLOAT64 != type) {
+      return false;
+    }
+    ofs << name << ((i + 1 < n_cols) ? separator : "\n");
+  } /* for(i..) */
+
+  /* blocks */
+  std::vector<double> values;
+  uint32_t n_rows = 0;
+  while (ifs.read(reinterpret_cast<char*>(&n_rows), sizeof(n_rows))) {
+    values.resize(static_cast<size_t>(n_rows) * n_cols);
+    ifs.read(reinterpret_cast<char*>(values.data()),
+             static_cast<std::streamsize>(values.size() * sizeof(double)));
+    if (!ifs) {
+      return false;
+    }
+    for (size_t r = 0; r < n_rows; ++r) {
+      for (size_t c = 0; c < n_cols; ++c) {
+        ofs << values[c * n_rows + r] << ((c + 1 < n_cols) ? separator : "\n");
+      } /* for(c..) */
+    } /* for(r..) */
+  } /* while(...) */
+  return ifs.eof();
+} /* to_csv() */
+
+NS_END(metrics, cosm);
@@ -45,7 +45,20 @@ transport_metrics_collector::transport_metrics_collector(
  ******************************************************************************/
 std::list<std::string> transport_metrics_collector::csv_header_cols(void) const {
   auto merged = dflt_csv_header_cols();
-  auto cols = std::list<std::string>{
+  auto cols = data_cols();
+  merged.splice(merged.end(), cols);
+  return merged;
+} /* csv_header_cols() */
+
+std::vector<std::string> transport_metrics_collector::binary_cols(void) const {
+  auto cols = data_cols();
+  std::vector<std::string> ret = {"clock"};
+  ret.insert(ret.end(), cols.begin(), cols.end());
+  return ret;
+} /* binary_cols() */
+
+std::list<std::string> transport_metrics_collector::data_cols(void) const {
+  return {
       /* clang-format off */
     "cum_transported",
     "cum_ramp_transported",
@@ -64,9 +77,7 @@ std::list<std::string> transport_metrics_collector::csv_header_cols(void) const
     "cum_avg_initial_wait_time"
       /* clang-format on */
   };
-  merged.splice(merged.end(), cols);
-  return merged;
-} /* csv_header_cols() */
+} /* data_cols() */
 
 void transport_metrics_collector::reset(void) {
   base_metrics_collector::reset();
@@ -77,27 +88,56 @@ boost::optional<std::string> transport_metrics_collector::csv_line_build(void) {
   if (!(timestep() % interval() == 0)) {
     return boost::none;
   }
+  if (binary_output_enabled()) {
+    binary_row_append(
+        static_cast<double>(timestep().v()),
+        static_cast<double>(m_cum.transported.load()),
+        static_cast<double>(m_cum.ramp_transported.load()),
+        static_cast<double>(m_cum.cube_transported.load()),
+        binary_avg(m_interval.transported.load(), interval().v()),
+        binary_avg(m_cum.transported.load(), timestep().v()),
+        binary_avg(m_interval.cube_transported.load(), interval().v()),
+        binary_avg(m_cum.cube_transported.load(), timestep().v()),
+        binary_avg(m_interval.ramp_transported.load(), interval().v()),
+        binary_avg(m_cum.ramp_transported.load(), timestep().v()),
+        binary_avg(m_interval.transporters.load(),
+                   m_interval.transported.load()),
+        binary_avg(m_cum.transporters.load(), m_cum.transported.load()),
+        binary_avg(m_interval.transport_time.load(),
+                   m_interval.transported.load()),
+        binary_avg(m_cum.transport_time.load(), m_cum.transported.load()),
+        binary_avg(m_interval.initial_wait_time.load(),
+                   m_interval.transported.load()),
+        binary_avg(m_cum.initial_wait_time.load(), m_cum.transported.load()));
+    return boost::none;
+  }
   std::string line;
 
-  line += rcppsw::to_string(m_cum.transported) + separator();
-  line += rcppsw::to_string(m_cum.ramp_transported) + separator();
-  line += rcppsw::to_string(m_cum.cube_transported) + separator();
+  line += rcppsw::to_string(m_cum.transported.load()) + separator();
+  line += rcppsw::to_string(m_cum.ramp_transported.load()) + separator();
+  line += rcppsw::to_string(m_cum.cube_transported.load()) + separator();
 
-  line += csv_entry_intavg(m_interval.transported);
-  line += csv_entry_tsavg(m_cum.transported);
+  line += csv_entry_intavg(m_interval.transported.load());
+  line += csv_entry_tsavg(m_cum.transported.load());
 
-  line += csv_entry_intavg(m_interval.cube_transported);
-  line += csv_entry_tsavg(m_cum.cube_transported);
-  line += csv_entry_intavg(m_interval.ramp_transported);
-  line += csv_entry_tsavg(m_cum.ramp_transported);
-  line += csv_entry_domavg(m_interval.transporters, m_interval.transported);
-  line += csv_entry_domavg(m_cum.transporters, m_cum.transported);
+  line += csv_entry_intavg(m_interval.cube_transported.load());
+  line += csv_entry_tsavg(m_cum.cube_transported.load());
+  line += csv_entry_intavg(m_interval.ramp_transported.load());
+  line += csv_entry_tsavg(m_cum.ramp_transported.load());
+  line += csv_entry_domavg(m_interval.transporters.load(),
+                           m_interval.transported.load());
+  line += csv_entry_domavg(m_cum.transporters.load(), m_cum.transported.load());
 
-  line += csv_entry_domavg(m_interval.transport_time, m_interval.transported);
-  line += csv_entry_domavg(m_cum.transport_time, m_cum.transported);
+  line += csv_entry_domavg(m_interval.transport_time.load(),
+                           m_interval.transported.load());
+  line += csv_entry_domavg(m_cum.transport_time.load(),
+                           m_cum.transported.load());
 
-  line += csv_entry_domavg(m_interval.initial_wait_time, m_interval.transported);
-  line += csv_entry_domavg(m_cum.initial_wait_time, m_cum.transported, true);
+  line += csv_entry_domavg(m_interval.initial_wait_time.load(),
+                           m_interval.transported.load());
+  line += csv_entry_domavg(m_cum.initial_wait_time.load(),
+                           m_cum.transported.load(),
+                           true);
 
   return boost::make_optional(line);
 } /* csv_line_build() */
@@ -123,12 +163,12 @@ void transport_metrics_collector::collect(const rmetrics::base_metrics& metrics)
 } /* collect() */
 
 void transport_metrics_collector::reset_after_interval(void) {
-  m_interval.transported = 0;
-  m_interval.cube_transported = 0;
-  m_interval.ramp_transported = 0;
-  m_interval.transporters = 0;
-  m_interval.transport_time = 0;
-  m_interval.initial_wait_time = 0;
+  m_interval.transported.reset();
+  m_interval.cube_transported.reset();
+  m_interval.ramp_transported.reset();
+  m_interval.transporters.reset();
+  m_interval.transport_time.reset();
+  m_interval.initial_wait_time.reset();
 } /* reset_after_interval() */
 
 NS_END(blocks, metrics, cosm);
@@ -23,6 +23,10 @@
  ******************************************************************************/
 #include "cosm/metrics/config/xml/metrics_parser.hpp"
 
+#include <boost/algorithm/string/trim.hpp>
+
+#include "rcppsw/utils/line_parser.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -42,6 +46,17 @@ void metrics_parser::parse(const ticpp::Element& node) {
 
   XML_PARSE_ATTR(mnode, m_config, output_dir);
 
+  if (mnode.HasAttribute("binary")) {
+    rcppsw::utils::line_parser parser(',');
+    for (auto& name : parser.parse(mnode.GetAttribute("binary"))) {
+      /* "a, b" is a common way to write a list */
+      boost::algorithm::trim(name);
+      if (!name.empty()) {
+        m_config->binary.insert(name);
+      }
+    } /* for(&name..) */
+  }
+
   if (nullptr != mnode.FirstChild("create", false)) {
     output_mode_parse(node_get(mnode, "create"), &m_config->create);
   }
@@ -69,7 +84,7 @@ void metrics_parser::output_mode_parse(ticpp::Element element,
 } /* output_mode_parse() */
 
 bool metrics_parser::is_collector_name(const ticpp::Attribute& attr) const {
-  std::list<std::string> non_names = {"collect_interval"};
+  std::list<std::string> non_names = {"collect_interval", "binary"};
   std::string name;
   attr.GetName(&name);
   return non_names.end() == std::find(non_names.begin(), non_names.end(), name);
@@ -43,23 +43,51 @@ tasking_oracle::tasking_oracle(const coconfig::tasking_oracle_config* const conf
     : ER_CLIENT_INIT("cosm.support.tasking_oracle"),
       mc_exec_ests(config->task_exec_ests),
       mc_int_ests(config->task_interface_ests) {
-  auto cb = [&](const cta::polled_task* task) {
-    m_map.insert({"exec_est." + task->name(), task->task_exec_estimate()});
-    m_map.insert(
-        {"interface_est." + task->name(), task->task_interface_estimate(0)});
-    ER_WARN("Assuming all tasks have at most 1 interface");
-  };
-  graph->walk(cb);
+  m_ests.reserve(graph->n_vertices() * kEstsPerTask);
+  for (size_t i = 0; i < graph->n_vertices(); ++i) {
+    const auto* task = graph->find_vertex(static_cast<int>(i));
+    ER_ASSERT(static_cast<int>(i) == task->vertex_id(),
+              "Task %s has bad vertex ID=%d",
+              task->name().c_str(),
+              task->vertex_id());
+    m_task_ids.insert({task->name(), i});
+
+    /* must match the estimate offsets */
+    m_ests.push_back(task->task_exec_estimate());
+    m_ests.push_back(task->task_interface_estimate(0));
+  } /* for(i..) */
+  ER_WARN("Assuming all tasks have at most 1 interface");
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+boost::optional<tasking_oracle::query_handle> tasking_oracle::compile(
+    const std::string& query) const {
+  auto dot = query.find('.');
+  if (std::string::npos == dot) {
+    return boost::none;
+  }
+  auto it = m_task_ids.find(query.substr(dot + 1));
+  if (m_task_ids.end() == it) {
+    return boost::none;
+  }
+  auto prefix = query.substr(0, dot);
+  if (kExecEstPrefix == prefix) {
+    return boost::make_optional(
+        query_handle{it->second * kEstsPerTask + kExecEstOffset});
+  } else if (kInterfaceEstPrefix == prefix) {
+    return boost::make_optional(
+        query_handle{it->second * kEstsPerTask + kInterfaceEstOffset});
+  }
+  return boost::none;
+} /* compile() */
+
 boost::optional<tasking_oracle::variant_type> tasking_oracle::ask(
     const std::string& query) const {
-  auto it = m_map.find(query);
-  return (it != m_map.end()) ? boost::make_optional(it->second)
-                             : boost::optional<variant_type>();
+  auto handle = compile(query);
+  return (handle) ? boost::make_optional(variant_type(ask(*handle)))
+                  : boost::optional<variant_type>();
 } /* ask() */
 
 void tasking_oracle::listener_add(cta::bi_tdgraph_executive* const executive) {
@@ -70,27 +98,7 @@ void tasking_oracle::listener_add(cta::bi_tdgraph_executive* const executive) {
 } /* listener_add() */
 
 void tasking_oracle::task_finish_cb(const cta::polled_task* task) {
-  auto& exec_est = boost::get<cta::time_estimate>(
-      m_map.find(kExecEstPrefix + std::string(".") + task->name())->second);
-  RCSW_UNUSED int exec_old = exec_est.v();
-  exec_est.calc(task->task_exec_estimate());
-
-  ER_DEBUG("Update exec_est.%s on finish: %d -> %d",
-           task->name().c_str(),
-           exec_old,
-           exec_est.v());
-
-  auto& int_est = boost::get<cta::time_estimate>(
-      m_map.find(kInterfaceEstPrefix + std::string(".") + task->name())->second);
-  RCSW_UNUSED int int_old = int_est.v();
-
-  /* Assuming 1 interface! */
-  int_est.calc(task->task_interface_estimate(0));
-
-  ER_DEBUG("Update interface_est.%s on finish: %d -> %d",
-           task->name().c_str(),
-           int_old,
-           int_est.v());
+  ests_update(task, "finish");
 } /* task_finish_cb() */
 
 void tasking_oracle::task_abort_cb(const cta::polled_task* task) {
@@ -104,27 +112,44 @@ void tasking_oracle::task_abort_cb(const cta::polled_task* task) {
    * Whether updating estimates on abort actually matters is tracked by #416,
    * and will be eventually be implemented.
    */
-  auto& exec_est = boost::get<cta::time_estimate>(
-      m_map.find(kExecEstPrefix + std::string(".") + task->name())->second);
+  ests_update(task, "abort");
+} /* task_abort_cb() */
+
+size_t tasking_oracle::task_index(const cta::polled_task* const task) const {
+  auto id = task->vertex_id();
+  if (id < 0 || static_cast<size_t>(id) >= m_ests.size() / kEstsPerTask) {
+    ER_FATAL_SENTINEL("Task %s with vertex ID=%d not in oracle graph",
+                      task->name().c_str(),
+                      id);
+  }
+  return static_cast<size_t>(id) * kEstsPerTask;
+} /* task_index() */
+
+void tasking_oracle::ests_update(const cta::polled_task* const task,
+                                 RCSW_UNUSED const char* const event) {
+  size_t index = task_index(task);
+
+  auto& exec_est = m_ests[index + kExecEstOffset];
   RCSW_UNUSED int exec_old = exec_est.v();
   exec_est.calc(task->task_exec_estimate());
 
-  ER_DEBUG("Update exec_est.%s on abort: %d -> %d",
+  ER_DEBUG("Update exec_est.%s on %s: %d -> %d",
            task->name().c_str(),
+           event,
            exec_old,
            exec_est.v());
 
-  auto& int_est = boost::get<cta::time_estimate>(
-      m_map.find(kInterfaceEstPrefix + std::string(".") + task->name())->second);
+  auto& int_est = m_ests[index + kInterfaceEstOffset];
   RCSW_UNUSED int int_old = int_est.v();
 
   /* Assuming 1 interface! */
   int_est.calc(task->task_interface_estimate(0));
 
-  ER_DEBUG("Update interface_est.%s on abort: %d -> %d",
+  ER_DEBUG("Update interface_est.%s on %s: %d -> %d",
            task->name().c_str(),
+           event,
            int_old,
            int_est.v());
-} /* task_abort_cb() */
+} /* ests_update() */
 
 NS_END(oracle, cosm);
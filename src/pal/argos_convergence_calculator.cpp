@@ -25,9 +25,6 @@
 
 #include <argos3/plugins/robots/foot-bot/simulator/footbot_entity.h>
 
-#include "rcppsw/algorithm/closest_pair2D.hpp"
-#include "rcppsw/math/vector2.hpp"
-
 #include "cosm/pal/argos_swarm_iterator.hpp"
 #include "cosm/pal/argos_controller2D_adaptor.hpp"
 #include "cosm/pal/argos_controllerQ3D_adaptor.hpp"
@@ -47,102 +44,41 @@ argos_convergence_calculator<TControllerType>::argos_convergence_calculator(
     : ER_CLIENT_INIT("cosm.pal.argos_convergence_calculator"),
       decorator(config),
       m_sm(sm) {
-  decoratee().angular_order_init(
-      std::bind(&argos_convergence_calculator::calc_robot_headings2D,
-                this,
-                std::placeholders::_1));
-  decoratee().interactivity_init(
-      std::bind(&argos_convergence_calculator::calc_robot_nn,
-                this,
-                std::placeholders::_1));
-  decoratee().positional_entropy_init(
-      std::bind(&argos_convergence_calculator::calc_robot_positions,
+  decoratee().snapshot_init(
+      std::bind(&argos_convergence_calculator::calc_snapshot,
                 this,
-                std::placeholders::_1));
-  decoratee().velocity_init(
-      std::bind(&argos_convergence_calculator::calc_robot_positions,
-                this,
-                std::placeholders::_1));
+                std::placeholders::_1,
+                std::placeholders::_2));
+  decoratee().angular_order_init();
+  decoratee().interactivity_init();
+  decoratee().positional_entropy_init();
+  decoratee().velocity_init();
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 template<class TControllerType>
-std::vector<double> argos_convergence_calculator<TControllerType>::calc_robot_nn(
-    RCSW_UNUSED uint n_threads) const {
-  std::vector<rmath::vector2d> v;
-  auto cb = [&](auto* robot) {
-    v.push_back({robot->GetEmbodiedEntity().GetOriginAnchor().Position.GetX(),
-                 robot->GetEmbodiedEntity().GetOriginAnchor().Position.GetY()});
-  };
-  cpal::argos_swarm_iterator::robots<argos::CFootBotEntity,
-                                     cpal::iteration_order::ekSTATIC>(
-                                         m_sm, cb, kARGoSRobotType);
-
+void argos_convergence_calculator<TControllerType>::calc_snapshot(
+    cconvergence::swarm_snapshot* snapshot,
+    RCSW_UNUSED uint n_threads) {
   /*
-   * For each closest pair of robots we find, we add the corresponding distance
-   * TWICE to our results vector, because 2 robots i and j are each other's
-   * closest robots (if they were not, they would not have been returned by the
-   * algorithm).
+   * Each robot's entry in the snapshot is independent, so they can all be
+   * filled in parallel.
    */
-  std::vector<double> res;
-  size_t n_robots = m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size();
-
-#pragma omp parallel for num_threads(n_threads)
-  for (size_t i = 0; i < n_robots / 2; ++i) {
-    auto dist_func = std::bind(&rmath::vector2d::distance,
-                               std::placeholders::_1,
-                               std::placeholders::_2);
-    auto pts =
-        ralg::closest_pair2D<rmath::vector2d>()("recursive", v, dist_func);
-    size_t old = v.size();
-#pragma omp critical
-    {
-      v.erase(std::remove_if(v.begin(),
-                             v.end(),
-                             [&](const auto& pt) {
-                               return pt == pts.p1 || pt == pts.p2;
-                             }),
-              v.end());
-
-      ER_ASSERT(old == v.size() + 2,
-                "Closest pair of points not removed from set");
-      res.push_back(pts.dist);
-      res.push_back(pts.dist);
-    }
-  } /* for(i..) */
-
-  return res;
-} /* calc_robot_nn() */
+  snapshot->resize(
+      m_sm->swarm_entities<argos::CFootBotEntity>(kARGoSRobotType).size());
 
-template<class TControllerType>
-std::vector<rmath::radians> argos_convergence_calculator<TControllerType>::calc_robot_headings2D(uint) const {
-  std::vector<rmath::radians> v;
-
-
-  auto cb = [&](const auto* controller) {
-    v.push_back(controller->heading2D());
+  auto cb = [&](const auto* controller, size_t i) {
+    snapshot->ids[i] = controller->entity_id();
+    snapshot->positions[i] = controller->pos2D();
+    snapshot->headings[i] = controller->heading2D();
   };
   cpal::argos_swarm_iterator::controllers<argos::CFootBotEntity,
                                           TControllerType,
-                                          cpal::iteration_order::ekSTATIC>(
-      m_sm, cb, kARGoSRobotType);
-  return v;
-} /* calc_robot_headings2D() */
-
-template<class TControllerType>
-std::vector<rmath::vector2d> argos_convergence_calculator<TControllerType>::calc_robot_positions(
-    uint) const {
-  std::vector<rmath::vector2d> v;
-
-  auto cb = [&](const auto* controller) { v.push_back(controller->pos2D()); };
-  cpal::argos_swarm_iterator::controllers<argos::CFootBotEntity,
-                                          TControllerType,
-                                          cpal::iteration_order::ekSTATIC>(
-      m_sm, cb, kARGoSRobotType);
-  return v;
-} /* calc_robot_positions() */
+                                          cpal::iteration_order::ekPARALLEL>(
+      m_sm, cb, kARGoSRobotType, n_threads);
+} /* calc_snapshot() */
 
 /*******************************************************************************
  * Template Instantiations
@@ -59,7 +59,15 @@ argos_pd_adaptor<TControllerType>::argos_pd_adaptor(
       mc_arena_dim(arena_dim),
       m_envd(envd),
       m_rng(rng),
-      m_sm(sm) {}
+      m_sm(sm) {
+  for (auto& [name, robotp] : sm->GetSpace().GetEntitiesByType(kARGoSRobotType)) {
+    auto* entity = argos::any_cast<argos::CFootBotEntity*>(robotp);
+    auto* controller = static_cast<TControllerType*>(
+        &entity->GetControllableEntity().GetController());
+    m_alive.insert(controller->entity_id(), controller);
+    m_functional.insert(controller->entity_id(), controller);
+  } /* for(...) */
+}
 
 /*******************************************************************************
  * Member Functions
@@ -75,7 +83,7 @@ op_result argos_pd_adaptor<TControllerType>::robot_kill(void) {
             active_pop);
     return {rtypes::constants::kNoUUID, total_pop, active_pop};
   }
-  auto* controller = kill_victim_locate(total_pop);
+  auto* controller = kill_victim_locate();
 
   if (nullptr == controller) {
     ER_WARN("Unable to find kill victim: total_pop=%zu, active_pop=%zu",
@@ -99,11 +107,12 @@ op_result argos_pd_adaptor<TControllerType>::robot_kill(void) {
   /* remove robot from ARGoS */
   ER_INFO("Remove entity %s", name.c_str());
   m_sm->RemoveEntity(name);
+  m_sm->swarm_cache_invalidate();
+  m_alive.remove(id);
+  m_functional.remove(id);
 
   /* killing a robot reduces both the active and total populations */
-  return {id,
-        m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size(),
-        m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size()};
+  return {id, m_alive.size(), m_alive.size()};
 } /* robot_kill() */
 
 template<typename TControllerType>
@@ -123,9 +132,7 @@ op_result argos_pd_adaptor<TControllerType>::robot_add(int max_pop,
   for (size_t i = 0; i < kMaxOperationAttempts; ++i) {
     if (robot_attempt_add(id)) {
       /* adding a new robot increases both the total and active populations */
-      return {id,
-            m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size(),
-            m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).size()};
+      return {id, m_alive.size(), m_alive.size()};
     }
   } /* for(i..) */
   ER_FATAL_SENTINEL("Unable to add new robot to simulation");
@@ -143,7 +150,7 @@ op_result argos_pd_adaptor<TControllerType>::robot_malfunction(void) {
     return {rtypes::constants::kNoUUID, total_pop, active_pop};
   }
 
-  auto* controller = malfunction_victim_locate(total_pop);
+  auto* controller = malfunction_victim_locate();
 
   if (nullptr == controller) {
     ER_WARN("Unable to find malfunction victim: total_pop=%zu, active_pop=%zu",
@@ -157,6 +164,7 @@ op_result argos_pd_adaptor<TControllerType>::robot_malfunction(void) {
 
   cpops::argos_robot_malfunction visitor;
   visitor.visit(*controller);
+  m_functional.remove(controller->entity_id());
 
   /*
    * @todo: Once the ability to temporarily remove robots from ARGoS by removing
@@ -178,6 +186,7 @@ op_result argos_pd_adaptor<TControllerType>::robot_repair(const rtypes::type_uui
   auto* controller = static_cast<TControllerType*>(
       &entity->GetControllableEntity().GetController());
   visitor.visit(*controller);
+  m_functional.insert(controller->entity_id(), controller);
 
   size_t total_pop = swarm_total_population();
   size_t active_pop = swarm_active_population();
@@ -190,38 +199,23 @@ op_result argos_pd_adaptor<TControllerType>::robot_repair(const rtypes::type_uui
 } /* robot_repair() */
 
 template<typename TControllerType>
-TControllerType* argos_pd_adaptor<TControllerType>::malfunction_victim_locate(size_t total_pop) const {
-  auto range = rmath::rangei(0, total_pop - 1);
-
-  for (size_t i = 0; i < kMaxOperationAttempts; ++i) {
-    auto it = m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).begin();
-    std::advance(it, m_rng->uniform(range));
-    auto* entity = argos::any_cast<argos::CFootBotEntity*>(it->second);
-    auto* controller = static_cast<TControllerType*>(
-        &entity->GetControllableEntity().GetController());
-    if (!currently_repairing(controller->entity_id())) {
-      return controller;
-    }
-  } /* for(i..) */
-  return nullptr;
+TControllerType* argos_pd_adaptor<TControllerType>::malfunction_victim_locate(void) const {
+  /* Robots which are currently being repaired are not in the set */
+  if (m_functional.empty()) {
+    return nullptr;
+  }
+  auto range = rmath::rangei(0, static_cast<int>(m_functional.size()) - 1);
+  return m_functional[static_cast<size_t>(m_rng->uniform(range))].second;
 } /* malfunction_victim_locate() */
 
 template<typename TControllerType>
-TControllerType* argos_pd_adaptor<TControllerType>::kill_victim_locate(size_t total_pop) const {
-    auto range = rmath::rangei(0, total_pop - 1);
-  argos::CFootBotEntity* entity;
-  for (size_t i = 0; i < kMaxOperationAttempts; ++i) {
-    auto it = m_sm->GetSpace().GetEntitiesByType(kARGoSRobotType).begin();
-    std::advance(it, m_rng->uniform(range));
-    entity = argos::any_cast<argos::CFootBotEntity*>(it->second);
-    auto* controller = static_cast<TControllerType*>(
-        &entity->GetControllableEntity().GetController());
-    if (!already_killed(controller->entity_id())) {
-      return controller;
-      break;
-    }
-  } /* for(i..) */
-  return nullptr;
+TControllerType* argos_pd_adaptor<TControllerType>::kill_victim_locate(void) const {
+  /* Robots which have been killed are removed from the set */
+  if (m_alive.empty()) {
+    return nullptr;
+  }
+  auto range = rmath::rangei(0, static_cast<int>(m_alive.size()) - 1);
+  return m_alive[static_cast<size_t>(m_rng->uniform(range))].second;
 } /* kill_victim_locate() */
 
 template<typename TControllerType>
@@ -257,6 +251,7 @@ bool argos_pd_adaptor<TControllerType>::robot_attempt_add(const rtypes::type_uui
                                    kARGoSControllerXMLId,
                                    argos::CVector3(x, y, 0.0));
     m_sm->AddEntity(*fb);
+    m_sm->swarm_cache_invalidate();
     ER_INFO(
         "Added entity %s attached to physics engine %s at %s",
         fb->GetId().c_str(),
@@ -268,6 +263,8 @@ bool argos_pd_adaptor<TControllerType>::robot_attempt_add(const rtypes::type_uui
         &fb->GetControllableEntity().GetController());
 
     m_envd->register_controller(*controller);
+    m_alive.insert(id, controller);
+    m_functional.insert(id, controller);
 
     return true;
   } catch (argos::CARGoSException& e) {
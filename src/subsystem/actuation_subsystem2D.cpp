@@ -29,22 +29,33 @@
 NS_START(cosm, subsystem);
 
 /*******************************************************************************
- * Struct Definitions
+ * Constructors/Destructor
  ******************************************************************************/
-struct reset_visitor : public boost::static_visitor<void> {
-  template <typename TActuator>
-  void operator()(TActuator& actuator) const {
-    actuator.reset();
-  }
-};
+actuation_subsystem2D::actuation_subsystem2D(const actuator_map& actuators) {
+  for (auto& pair : actuators) {
+    boost::apply_visitor(
+        [&](const auto& actuator) {
+          using actuator_type = std::decay_t<decltype(actuator)>;
+          std::get<boost::optional<actuator_type>>(m_actuators).emplace(actuator);
+        },
+        pair.second);
+  } /* for(&pair..) */
+}
 
 /*******************************************************************************
- * Constructors/Destructor
+ * Member Functions
  ******************************************************************************/
 void actuation_subsystem2D::reset(void) {
-  for (auto& a : m_actuators) {
-    boost::apply_visitor(reset_visitor(), a.second);
-  } /* for(&a..) */
+  std::apply(
+      [](auto&... actuators) {
+        auto reset = [](auto& actuator) {
+          if (actuator) {
+            actuator->reset();
+          }
+        };
+        (reset(actuators), ...);
+      },
+      m_actuators);
 } /* reset() */
 
 NS_END(subsystem, cosm);
@@ -45,9 +45,7 @@ NS_START(cosm, ta);
  ******************************************************************************/
 polled_task* bi_tdgraph_allocator::operator()(const polled_task* current_task,
                                               uint alloc_count) const {
-  std::vector<polled_task*> tasks(m_graph->n_vertices());
-  m_graph->walk(
-      [&](polled_task* task) { tasks[m_graph->vertex_id(task)] = task; });
+  const auto& tasks = m_graph->tasks();
 
   if (kPolicyRandom == mc_config->policy) {
     return random_allocator(m_rng)(tasks);
@@ -99,18 +99,19 @@ boost::optional<std::string> population_dynamics_metrics_collector::csv_line_bui
   std::string line;
 
   /* population */
-  line += csv_entry_intavg(m_interval.total_population);
-  line += csv_entry_intavg(m_interval.active_population);
-  line += csv_entry_tsavg(m_cum.total_population);
-  line += csv_entry_tsavg(m_cum.active_population);
+  line += csv_entry_intavg(m_interval.total_population.load());
+  line += csv_entry_intavg(m_interval.active_population.load());
+  line += csv_entry_tsavg(m_cum.total_population.load());
+  line += csv_entry_tsavg(m_cum.active_population.load());
   line += rcppsw::to_string(m_interval.max_population) + separator();
 
   /* birth queue */
-  line += csv_entry_intavg(m_interval.n_births);
-  line += csv_entry_domavg(m_interval.birth_interval, m_interval.n_births);
+  line += csv_entry_intavg(m_interval.n_births.load());
+  line += csv_entry_domavg(m_interval.birth_interval.load(),
+                           m_interval.n_births.load());
 
-  line += csv_entry_tsavg(m_cum.n_births);
-  line += csv_entry_domavg(m_cum.birth_interval, m_cum.n_births);
+  line += csv_entry_tsavg(m_cum.n_births.load());
+  line += csv_entry_domavg(m_cum.birth_interval.load(), m_cum.n_births.load());
 
   line += rcppsw::to_string(m_interval.birth_mu) + separator();
 
@@ -124,24 +125,27 @@ boost::optional<std::string> population_dynamics_metrics_collector::csv_line_bui
   line += rcppsw::to_string(m_interval.death_lambda) + separator();
 
   /* repair queue */
-  line += csv_entry_intavg(m_interval.repair_queue_size);
-  line += csv_entry_tsavg(m_cum.repair_queue_size);
+  line += csv_entry_intavg(m_interval.repair_queue_size.load());
+  line += csv_entry_tsavg(m_cum.repair_queue_size.load());
 
   /* repair queue malfunctions */
-  line += csv_entry_intavg(m_interval.n_malfunctions);
-  line += csv_entry_domavg(m_interval.malfunction_interval,
-                           m_interval.n_malfunctions);
+  line += csv_entry_intavg(m_interval.n_malfunctions.load());
+  line += csv_entry_domavg(m_interval.malfunction_interval.load(),
+                           m_interval.n_malfunctions.load());
 
-  line += csv_entry_tsavg(m_cum.n_malfunctions);
-  line += csv_entry_domavg(m_cum.malfunction_interval, m_cum.n_malfunctions);
+  line += csv_entry_tsavg(m_cum.n_malfunctions.load());
+  line += csv_entry_domavg(m_cum.malfunction_interval.load(),
+                           m_cum.n_malfunctions.load());
   line += rcppsw::to_string(m_interval.malfunction_lambda) + separator();
 
   /* repair queue repairs */
-  line += csv_entry_intavg(m_interval.n_repairs);
-  line += csv_entry_domavg(m_interval.repair_interval, m_interval.n_repairs);
+  line += csv_entry_intavg(m_interval.n_repairs.load());
+  line += csv_entry_domavg(m_interval.repair_interval.load(),
+                           m_interval.n_repairs.load());
 
-  line += csv_entry_tsavg(m_cum.n_repairs);
-  line += csv_entry_domavg(m_cum.repair_interval, m_cum.n_repairs);
+  line += csv_entry_tsavg(m_cum.n_repairs.load());
+  line += csv_entry_domavg(m_cum.repair_interval.load(),
+                           m_cum.n_repairs.load());
   line += rcppsw::to_string(m_interval.repair_mu);
 
   return boost::make_optional(line);
@@ -205,25 +209,25 @@ void population_dynamics_metrics_collector::collect(
 } /* collect() */
 
 void population_dynamics_metrics_collector::reset_after_interval(void) {
-  m_interval.total_population = 0;
-  m_interval.active_population = 0;
+  m_interval.total_population.reset();
+  m_interval.active_population.reset();
   m_interval.max_population = 0;
 
-  m_interval.n_births = 0;
-  m_interval.birth_interval = 0;
+  m_interval.n_births.reset();
+  m_interval.birth_interval.reset();
   m_interval.birth_mu = 0;
 
-  m_interval.n_deaths = 0;
-  m_interval.death_interval = 0;
+  m_interval.n_deaths.reset();
+  m_interval.death_interval.reset();
   m_interval.death_lambda = 0;
 
-  m_interval.repair_queue_size = 0;
-  m_interval.n_malfunctions = 0;
-  m_interval.malfunction_interval = 0;
+  m_interval.repair_queue_size.reset();
+  m_interval.n_malfunctions.reset();
+  m_interval.malfunction_interval.reset();
   m_interval.malfunction_lambda = 0;
 
-  m_interval.n_repairs = 0;
-  m_interval.repair_interval = 0;
+  m_interval.n_repairs.reset();
+  m_interval.repair_interval.reset();
   m_interval.repair_mu = 0;
 } /* reset_after_interval() */
 
@@ -46,10 +46,15 @@ robot_dynamics_applicator::robot_dynamics_applicator(
  ******************************************************************************/
 void robot_dynamics_applicator::register_controller(const rtypes::type_uuid& id) {
   if (mc_motion_throttle_config) {
-    m_motion_throttlers.emplace(std::piecewise_construct,
-                                std::forward_as_tuple(id),
-                                std::forward_as_tuple(
-                                    &mc_motion_throttle_config.get()));
+    ER_ASSERT(id.v() >= 0, "Bad controller ID=%d", id.v());
+    auto slot = static_cast<size_t>(id.v());
+    if (slot >= m_motion_throttlers.size()) {
+      m_motion_throttlers.resize(slot + 1);
+    }
+    ER_ASSERT(!m_motion_throttlers[slot],
+              "Controller with ID=%d already registered",
+              id.v());
+    m_motion_throttlers[slot].emplace(&mc_motion_throttle_config.get());
     ER_INFO("Registered controller with ID=%d", id.v());
   }
 } /* register_controller() */
@@ -57,9 +62,20 @@ void robot_dynamics_applicator::register_controller(const rtypes::type_uuid& id)
 void robot_dynamics_applicator::unregister_controller(
     const rtypes::type_uuid& id) {
   if (mc_motion_throttle_config) {
-    m_motion_throttlers.erase(id);
+    if (motion_throttler_registered(id)) {
+      m_motion_throttlers[static_cast<size_t>(id.v())] = boost::none;
+    }
     ER_INFO("Unregistered controller with ID=%d", id.v());
   }
 } /* unregister_controller() */
 
+void robot_dynamics_applicator::motion_throttlers_update(
+    const rtypes::timestep& t) {
+  for (auto& throttler : m_motion_throttlers) {
+    if (throttler) {
+      throttler->update(t);
+    }
+  } /* for(&throttler..) */
+} /* motion_throttlers_update() */
+
 NS_END(tv, cosm);
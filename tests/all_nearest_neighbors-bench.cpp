@@ -0,0 +1,144 @@
+/**
+ * \file all_nearest_neighbors-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "rcppsw/algorithm/closest_pair2D.hpp"
+
+#include "cosm/convergence/all_nearest_neighbors.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cconvergence = cosm::convergence;
+namespace rmath = rcppsw::math;
+namespace ralg = rcppsw::algorithm;
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+/*
+ * What \ref all_nearest_neighbors replaced in
+ * \ref cosm::pal::argos_convergence_calculator::calc_robot_nn(): repeatedly
+ * find the closest pair among the remaining points, record its distance twice
+ * and remove it. Its OpenMP loop ran inside a critical section, so it is run
+ * serially here. It does not compute each point's nearest neighbor, so its
+ * results are not compared.
+ */
+static std::vector<double> closest_pairs(std::vector<rmath::vector2d> pts) {
+  std::vector<double> res;
+  auto dist_func = std::bind(&rmath::vector2d::distance,
+                             std::placeholders::_1,
+                             std::placeholders::_2);
+  size_t n_pts = pts.size();
+  for (size_t i = 0; i < n_pts / 2 && pts.size() >= 2; ++i) {
+    auto pair =
+        ralg::closest_pair2D<rmath::vector2d>()("recursive", pts, dist_func);
+    pts.erase(std::remove_if(pts.begin(),
+                             pts.end(),
+                             [&](const auto& pt) {
+                               return pt == pair.p1 || pt == pair.p2;
+                             }),
+              pts.end());
+    res.push_back(pair.dist);
+    res.push_back(pair.dist);
+  } /* for(i..) */
+  return res;
+} /* closest_pairs() */
+
+/*
+ * O(n^2) all-pairs nearest neighbors, as the reference for the results of
+ * \ref all_nearest_neighbors.
+ */
+static std::vector<double> brute_force(const std::vector<rmath::vector2d>& pts) {
+  std::vector<double> res(pts.size(), std::numeric_limits<double>::max());
+  for (size_t i = 0; i < pts.size(); ++i) {
+    for (size_t j = 0; j < pts.size(); ++j) {
+      if (i != j) {
+        res[i] = std::min(res[i], pts[i].distance(pts[j]));
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  return res;
+} /* brute_force() */
+
+template <typename TFunc>
+static double time_ms(const TFunc& f, std::vector<double>* res) {
+  auto start = std::chrono::steady_clock::now();
+  *res = f();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+} /* time_ms() */
+
+static void run(const char* name, const std::vector<rmath::vector2d>& pts) {
+  std::vector<double> grid;
+  std::vector<double> pairs;
+  std::vector<double> brute;
+  double grid_ms =
+      time_ms([&]() { return cconvergence::all_nearest_neighbors()(pts, 1); },
+              &grid);
+  double pairs_ms = time_ms([&]() { return closest_pairs(pts); }, &pairs);
+  double brute_ms = time_ms([&]() { return brute_force(pts); }, &brute);
+  std::printf("%-12s %8zu %12.3f %12.3f %12.3f %8s\n",
+              name,
+              pts.size(),
+              grid_ms,
+              pairs_ms,
+              brute_ms,
+              grid == brute ? "yes" : "NO");
+} /* run() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<double> coord(0.0, 100.0);
+  std::uniform_real_distribution<double> jitter(0.0, 1e-9);
+
+  std::printf("%-12s %8s %12s %12s %12s %8s\n",
+              "layout",
+              "n",
+              "grid ms",
+              "pairs ms",
+              "brute ms",
+              "match");
+  for (size_t n : { 100, 1000, 10000 }) {
+    std::vector<rmath::vector2d> uniform;
+    std::vector<rmath::vector2d> collinear;
+    for (size_t i = 0; i < n; ++i) {
+      uniform.emplace_back(coord(rng), coord(rng));
+      collinear.emplace_back(coord(rng), 50.0 + jitter(rng));
+    } /* for(i..) */
+    run("uniform", uniform);
+    run("collinear", collinear);
+  } /* for(n..) */
+  return 0;
+} /* main() */
@@ -0,0 +1,120 @@
+/**
+ * \file arena_grid_lock-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "cosm/ds/arena_grid.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Contention between robots dropping/picking up free blocks in the arena grid,
+ * with each operation locking the whole grid vs. only the tile containing its
+ * cell (see \ref cds::arena_grid::region_lock()).
+ */
+static constexpr size_t kOpsPerThread = 200000;
+static constexpr size_t kWorkPerOp = 200;
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+template <typename TLockFunc, typename TUnlockFunc>
+static double run(cds::arena_grid& grid,
+                  size_t n_threads,
+                  const TLockFunc& lock,
+                  const TUnlockFunc& unlock) {
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < n_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::mt19937 rng(static_cast<uint>(t));
+      std::uniform_int_distribution<size_t> xdist(0, grid.xdsize() - 1);
+      std::uniform_int_distribution<size_t> ydist(0, grid.ydsize() - 1);
+      for (size_t i = 0; i < kOpsPerThread; ++i) {
+        rmath::vector2z coord(xdist(rng), ydist(rng));
+        lock(coord);
+
+        /* stand-in for the overlap checks/cell update a drop does */
+        auto& cell = grid.access<cds::arena_grid::kCell>(coord);
+        volatile size_t sink = 0;
+        for (size_t j = 0; j < kWorkPerOp; ++j) {
+          sink = sink + cell.loc().x() + j;
+        } /* for(j..) */
+        cell.entity(nullptr);
+
+        unlock(coord);
+      } /* for(i..) */
+    });
+  } /* for(t..) */
+  for (auto& thread : threads) {
+    thread.join();
+  } /* for(&thread..) */
+  auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start);
+  return static_cast<double>(n_threads * kOpsPerThread) / elapsed.count();
+} /* run() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  /* 128x128 cells */
+  cds::arena_grid grid(rmath::vector2d(64.0, 64.0),
+                       rtypes::discretize_ratio(0.5));
+
+  std::printf("grid=%zux%zu, tile=%zu, ops/thread=%zu\n",
+              grid.xdsize(),
+              grid.ydsize(),
+              cds::arena_grid::kLockTileDim,
+              kOpsPerThread);
+  std::printf("%8s %16s %16s\n", "threads", "grid ops/s", "tiled ops/s");
+
+  size_t max_threads = std::max(1U, std::thread::hardware_concurrency());
+  for (size_t n_threads = 1; n_threads <= max_threads; n_threads *= 2) {
+    double whole = run(
+        grid,
+        n_threads,
+        [&](const rmath::vector2z&) { grid.mtx()->lock(); },
+        [&](const rmath::vector2z&) { grid.mtx()->unlock(); });
+    double tiled = run(
+        grid,
+        n_threads,
+        [&](const rmath::vector2z& c) { grid.region_lock(c, c); },
+        [&](const rmath::vector2z& c) { grid.region_unlock(c, c); });
+    std::printf("%8zu %16.0f %16.0f\n", n_threads, whole, tiled);
+  } /* for(n_threads..) */
+  return 0;
+} /* main() */
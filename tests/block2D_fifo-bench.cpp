@@ -0,0 +1,104 @@
+/**
+ * \file block2D_fifo-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "cosm/ds/block2D_fifo.hpp"
+#include "cosm/repr/cube_block2D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * One cache operation cycle: a robot picks up the oldest block, drops it
+ * back, the block is checked for membership, and the cache is cloned (as for
+ * each robot's LOS), vs. the block vector caches used to store their blocks
+ * in.
+ */
+static constexpr size_t kCyclesPerRun = 1000000;
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+template <typename TFunc>
+static double time_ns(const TFunc& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kCyclesPerRun; ++i) {
+    f();
+  } /* for(i..) */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(kCyclesPerRun);
+} /* time_ns() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  volatile size_t sink = 0;
+
+  std::printf("%8s %14s %14s\n", "blocks", "vector ns", "fifo ns");
+  for (int n_blocks : { 10, 100, 1000 }) {
+    std::vector<std::unique_ptr<crepr::cube_block2D>> blocks;
+    cds::block2D_vectorno vec;
+    for (int i = 0; i < n_blocks; ++i) {
+      blocks.push_back(std::make_unique<crepr::cube_block2D>(
+          rmath::vector2d(1.0, 1.0), rtypes::type_uuid(i)));
+      vec.push_back(blocks.back().get());
+    } /* for(i..) */
+    cds::block2D_fifo fifo(vec);
+
+    double vec_ns = time_ns([&]() {
+      auto* block = vec.front();
+      vec.erase(vec.begin());
+      vec.push_back(block);
+      auto it = std::find_if(vec.begin(), vec.end(), [&](const auto* b) {
+        return b->idcmp(*block);
+      });
+      cds::block2D_vectorno clone(vec);
+      sink = sink + clone.size() + (vec.end() != it);
+    });
+    double fifo_ns = time_ns([&]() {
+      auto* block = fifo.front();
+      fifo.remove(block);
+      fifo.push_back(block);
+      cds::block2D_fifo clone(fifo);
+      sink = sink + clone.size() + fifo.contains(block->id());
+    });
+    std::printf("%8d %14.1f %14.1f\n", n_blocks, vec_ns, fifo_ns);
+  } /* for(n_blocks..) */
+  return 0;
+} /* main() */
@@ -0,0 +1,181 @@
+/**
+ * \file block2D_fifo-test.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include <memory>
+#include <vector>
+
+#include "cosm/ds/block2D_fifo.hpp"
+#include "cosm/repr/cube_block2D.hpp"
+#include <catch.hpp>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Test Helpers
+ ******************************************************************************/
+static std::vector<std::unique_ptr<crepr::cube_block2D>> make_blocks(int n) {
+  std::vector<std::unique_ptr<crepr::cube_block2D>> blocks;
+  for (int i = 0; i < n; ++i) {
+    blocks.push_back(std::make_unique<crepr::cube_block2D>(
+        rmath::vector2d(1.0, 1.0), rtypes::type_uuid(i)));
+  } /* for(i..) */
+  return blocks;
+}
+
+/*
+ * The IDs of the blocks in the queue, oldest first.
+ */
+static std::vector<int> ids(const cds::block2D_fifo& fifo) {
+  std::vector<int> ret;
+  for (const auto* block : fifo) {
+    ret.push_back(block->id().v());
+  } /* for(*block..) */
+  return ret;
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("push-test", "[block2D_fifo]") {
+  auto blocks = make_blocks(3);
+  cds::block2D_fifo fifo;
+  CATCH_REQUIRE(fifo.empty());
+
+  for (auto& block : blocks) {
+    CATCH_REQUIRE(fifo.push_back(block.get()));
+  } /* for(&block..) */
+  CATCH_REQUIRE(3 == fifo.size());
+  CATCH_REQUIRE(blocks[0].get() == fifo.front());
+  CATCH_REQUIRE((std::vector<int>{ 0, 1, 2 }) == ids(fifo));
+  for (auto& block : blocks) {
+    CATCH_REQUIRE(fifo.contains(block->id()));
+  } /* for(&block..) */
+  CATCH_REQUIRE(!fifo.contains(rtypes::type_uuid(3)));
+}
+
+CATCH_TEST_CASE("duplicate-push-test", "[block2D_fifo]") {
+  auto blocks = make_blocks(2);
+  crepr::cube_block2D twin(rmath::vector2d(1.0, 1.0), rtypes::type_uuid(1));
+  cds::block2D_fifo fifo;
+  CATCH_REQUIRE(fifo.push_back(blocks[0].get()));
+  CATCH_REQUIRE(fifo.push_back(blocks[1].get()));
+
+  /* the same block, or a different block with the same ID */
+  CATCH_REQUIRE(!fifo.push_back(blocks[0].get()));
+  CATCH_REQUIRE(!fifo.push_back(&twin));
+  CATCH_REQUIRE(2 == fifo.size());
+  CATCH_REQUIRE((std::vector<int>{ 0, 1 }) == ids(fifo));
+
+  /* duplicates in the initial blocks are dropped */
+  cds::block2D_fifo fifo2(cds::block2D_vectorno{ blocks[1].get(),
+                                                 blocks[0].get(),
+                                                 &twin });
+  CATCH_REQUIRE(2 == fifo2.size());
+  CATCH_REQUIRE((std::vector<int>{ 1, 0 }) == ids(fifo2));
+}
+
+CATCH_TEST_CASE("remove-test", "[block2D_fifo]") {
+  auto blocks = make_blocks(5);
+  cds::block2D_fifo fifo;
+  for (auto& block : blocks) {
+    CATCH_REQUIRE(fifo.push_back(block.get()));
+  } /* for(&block..) */
+
+  /* oldest */
+  CATCH_REQUIRE(fifo.remove(blocks[0].get()));
+  CATCH_REQUIRE(!fifo.contains(blocks[0]->id()));
+  CATCH_REQUIRE(blocks[1].get() == fifo.front());
+  CATCH_REQUIRE((std::vector<int>{ 1, 2, 3, 4 }) == ids(fifo));
+
+  /* middle, by a different block with the same ID: order is kept */
+  crepr::cube_block2D twin(rmath::vector2d(1.0, 1.0), rtypes::type_uuid(3));
+  CATCH_REQUIRE(fifo.remove(&twin));
+  CATCH_REQUIRE(!fifo.contains(blocks[3]->id()));
+  CATCH_REQUIRE((std::vector<int>{ 1, 2, 4 }) == ids(fifo));
+
+  /* newest */
+  CATCH_REQUIRE(fifo.remove(blocks[4].get()));
+  CATCH_REQUIRE((std::vector<int>{ 1, 2 }) == ids(fifo));
+
+  /* not present */
+  CATCH_REQUIRE(!fifo.remove(blocks[0].get()));
+  CATCH_REQUIRE(2 == fifo.size());
+
+  /* removed blocks can be added again, at the back */
+  CATCH_REQUIRE(fifo.push_back(blocks[0].get()));
+  CATCH_REQUIRE((std::vector<int>{ 1, 2, 0 }) == ids(fifo));
+
+  CATCH_REQUIRE(fifo.remove(blocks[1].get()));
+  CATCH_REQUIRE(fifo.remove(blocks[2].get()));
+  CATCH_REQUIRE(fifo.remove(blocks[0].get()));
+  CATCH_REQUIRE(fifo.empty());
+}
+
+CATCH_TEST_CASE("copy-on-write-test", "[block2D_fifo]") {
+  auto blocks = make_blocks(4);
+  cds::block2D_fifo orig;
+  CATCH_REQUIRE(orig.push_back(blocks[0].get()));
+  CATCH_REQUIRE(orig.push_back(blocks[1].get()));
+
+  /* modifying a copy does not affect the original... */
+  cds::block2D_fifo copy1(orig);
+  CATCH_REQUIRE(copy1.push_back(blocks[2].get()));
+  CATCH_REQUIRE(copy1.remove(blocks[0].get()));
+  CATCH_REQUIRE((std::vector<int>{ 0, 1 }) == ids(orig));
+  CATCH_REQUIRE(orig.contains(blocks[0]->id()));
+  CATCH_REQUIRE(!orig.contains(blocks[2]->id()));
+  CATCH_REQUIRE((std::vector<int>{ 1, 2 }) == ids(copy1));
+  CATCH_REQUIRE(!copy1.contains(blocks[0]->id()));
+
+  /* ...and modifying the original does not affect a copy */
+  cds::block2D_fifo copy2 = orig;
+  CATCH_REQUIRE(orig.push_back(blocks[3].get()));
+  CATCH_REQUIRE(orig.remove(blocks[1].get()));
+  CATCH_REQUIRE((std::vector<int>{ 0, 3 }) == ids(orig));
+  CATCH_REQUIRE((std::vector<int>{ 0, 1 }) == ids(copy2));
+  CATCH_REQUIRE(!copy2.contains(blocks[3]->id()));
+  CATCH_REQUIRE(copy2.contains(blocks[1]->id()));
+
+  /* copies of copies, and failed modifications */
+  cds::block2D_fifo copy3(copy2);
+  CATCH_REQUIRE(!copy3.push_back(blocks[0].get()));
+  CATCH_REQUIRE(!copy3.remove(blocks[3].get()));
+  CATCH_REQUIRE(copy3.remove(blocks[0].get()));
+  CATCH_REQUIRE((std::vector<int>{ 1 }) == ids(copy3));
+  CATCH_REQUIRE((std::vector<int>{ 0, 1 }) == ids(copy2));
+
+  /* assignment */
+  copy3 = orig;
+  CATCH_REQUIRE((std::vector<int>{ 0, 3 }) == ids(copy3));
+  CATCH_REQUIRE(copy3.remove(blocks[0].get()));
+  CATCH_REQUIRE((std::vector<int>{ 0, 3 }) == ids(orig));
+  CATCH_REQUIRE((std::vector<int>{ 3 }) == ids(copy3));
+}
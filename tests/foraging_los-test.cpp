@@ -0,0 +1,185 @@
+/**
+ * \file foraging_los-test.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include "cosm/hal/hal.hpp"
+
+/*
+ * The LOS is not built for the native-sim target (see project-local.cmake).
+ */
+#if COSM_HAL_TARGET != HAL_TARGET_NATIVE_SIM
+#include <memory>
+#include <utility>
+
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/ds/cell2D.hpp"
+#include "cosm/foraging/operations/robot_los_update.hpp"
+#include "cosm/foraging/repr/foraging_los.hpp"
+#include "cosm/foraging/utils/utils.hpp"
+#endif
+#include <catch.hpp>
+
+#if COSM_HAL_TARGET != HAL_TARGET_NATIVE_SIM
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace cfops = cosm::foraging::operations;
+namespace cfrepr = cosm::foraging::repr;
+namespace cfutils = cosm::foraging::utils;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Test Helpers
+ ******************************************************************************/
+/*
+ * The parts of the arena map used to compute/update a robot's LOS, so that the
+ * LOS can be tested on an arena grid without ARGoS.
+ */
+class test_map {
+ public:
+  test_map(void)
+      : m_grid(rmath::vector2d(10.0, 10.0), rtypes::discretize_ratio(0.5)) {}
+
+  rtypes::discretize_ratio grid_resolution(void) const {
+    return m_grid.resolution();
+  }
+  cds::arena_grid::const_view subgrid(const rmath::vector2z& center,
+                                      size_t radius) const {
+    return m_grid.layer<cds::arena_grid::kCell>()->subcircle(center, radius);
+  }
+
+ private:
+  /* clang-format off */
+  cds::arena_grid m_grid;
+  /* clang-format on */
+};
+
+/*
+ * A controller which provides non-const access to its LOS, so that it can be
+ * reset in place, and counts how many times it is given a new one.
+ */
+class test_controller {
+ public:
+  explicit test_controller(const rmath::vector2d& pos) : m_pos(pos) {}
+
+  /* 2 cells at the test_map resolution */
+  double los_dim(void) const { return 1.0; }
+  const rmath::vector2d& pos2D(void) const { return m_pos; }
+  void pos2D(const rmath::vector2d& pos) { m_pos = pos; }
+
+  cfrepr::foraging_los* los(void) { return m_los.get(); }
+  void los(std::unique_ptr<cfrepr::foraging_los> los) {
+    m_los = std::move(los);
+    ++m_n_los_set;
+  }
+  size_t n_los_set(void) const { return m_n_los_set; }
+
+ private:
+  /* clang-format off */
+  rmath::vector2d                       m_pos;
+  std::unique_ptr<cfrepr::foraging_los> m_los{nullptr};
+  size_t                                m_n_los_set{0};
+  /* clang-format on */
+};
+
+static_assert(cfutils::detail::has_mutable_los<test_controller>::value,
+              "test_controller LOS not detected as mutable");
+
+/*
+ * The LOS must view exactly the same cells as a LOS freshly built at the same
+ * position.
+ */
+static void require_same_view(const cfrepr::foraging_los& los,
+                              const cfrepr::foraging_los& fresh) {
+  CATCH_REQUIRE(fresh.xsize() == los.xsize());
+  CATCH_REQUIRE(fresh.ysize() == los.ysize());
+  CATCH_REQUIRE(fresh.size() == los.size());
+  CATCH_REQUIRE(fresh.abs_ll() == los.abs_ll());
+  CATCH_REQUIRE(fresh.abs_ur() == los.abs_ur());
+  CATCH_REQUIRE(&fresh.cell(0, 0) == &los.cell(0, 0));
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("reset-test", "[foraging_los]") {
+  test_map map;
+  rmath::vector2z start(10, 10);
+  cfrepr::foraging_los los(map.subgrid(start, 2), start);
+
+  rmath::vector2z start_ll = los.abs_ll();
+  size_t full_size = los.size();
+
+  /* to another full sized LOS */
+  rmath::vector2z center(14, 6);
+  los.reset(map.subgrid(center, 2), center);
+  CATCH_REQUIRE(!(start_ll == los.abs_ll()));
+  CATCH_REQUIRE(full_size == los.size());
+  require_same_view(los, cfrepr::foraging_los(map.subgrid(center, 2), center));
+
+  /* to a LOS truncated by the arena boundary, and back */
+  rmath::vector2z corner(0, 1);
+  los.reset(map.subgrid(corner, 2), corner);
+  CATCH_REQUIRE(full_size > los.size());
+  require_same_view(los, cfrepr::foraging_los(map.subgrid(corner, 2), corner));
+
+  los.reset(map.subgrid(start, 2), start);
+  require_same_view(los, cfrepr::foraging_los(map.subgrid(start, 2), start));
+}
+
+/*
+ * Each swarm_los_update pass applies robot_los_update to every robot, which
+ * needs ARGoS to run, so robot_los_update is applied directly here.
+ */
+CATCH_TEST_CASE("reuse-test", "[foraging_los]") {
+  test_map map;
+  test_controller c(rmath::vector2d(5.0, 5.0));
+  cfops::robot_los_update<test_controller, test_map> update(&map);
+
+  /* the first update has to create the LOS */
+  update(&c);
+  CATCH_REQUIRE(nullptr != c.los());
+  CATCH_REQUIRE(1 == c.n_los_set());
+  const cfrepr::foraging_los* first = c.los();
+
+  /* later updates move the same LOS along with the robot */
+  c.pos2D(rmath::vector2d(2.0, 7.5));
+  update(&c);
+  CATCH_REQUIRE(first == c.los());
+  CATCH_REQUIRE(1 == c.n_los_set());
+  require_same_view(*c.los(),
+                    *cfutils::compute_robot_los(map, 2, c.pos2D()));
+
+  c.pos2D(rmath::vector2d(9.9, 0.1));
+  update(&c);
+  CATCH_REQUIRE(first == c.los());
+  CATCH_REQUIRE(1 == c.n_los_set());
+  require_same_view(*c.los(),
+                    *cfutils::compute_robot_los(map, 2, c.pos2D()));
+}
+
+#endif /* COSM_HAL_TARGET != HAL_TARGET_NATIVE_SIM */
@@ -0,0 +1,110 @@
+/**
+ * \file los_scan-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstdio>
+
+#include "cosm/ds/arena_grid.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * One scan of all cells in a LOS-sized view of the arena grid, as done by
+ * \ref cosm::foraging::repr::foraging_los::blocks()/caches(), via nested
+ * multi_array sub-views vs. walking the view's origin and strides. Every 7th
+ * cell has a block. The LOS itself is not used, as it needs a full arena map.
+ */
+static constexpr size_t kCellsPerRun = 50000000;
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+template <typename TFunc>
+static double time_us(size_t n_scans, const TFunc& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n_scans; ++i) {
+    f();
+  } /* for(i..) */
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(n_scans);
+} /* time_us() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  /* 256x256 cells */
+  cds::arena_grid grid(rmath::vector2d(128.0, 128.0),
+                       rtypes::discretize_ratio(0.5));
+  for (size_t i = 0; i < grid.xdsize(); ++i) {
+    for (size_t j = 0; j < grid.ydsize(); ++j) {
+      if (0 == (i * grid.ydsize() + j) % 7) {
+        grid.access<cds::arena_grid::kCell>(i, j).fsm().event_block_drop();
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  volatile size_t sink = 0;
+
+  std::printf("%8s %14s %14s\n", "los", "nested us", "strided us");
+  for (size_t dim : { 11, 41, 101 }) {
+    rmath::vector2z ll(grid.xdsize() / 2 - dim / 2, grid.ydsize() / 2 - dim / 2);
+    rmath::vector2z ur(ll.x() + dim - 1, ll.y() + dim - 1);
+    auto view = grid.layer<cds::arena_grid::kCell>()->subgrid(ll, ur);
+    size_t n_scans = kCellsPerRun / (dim * dim);
+
+    double nested = time_us(n_scans, [&]() {
+      size_t n = 0;
+      for (size_t i = 0; i < view.shape()[0]; ++i) {
+        for (size_t j = 0; j < view.shape()[1]; ++j) {
+          n += view[i][j].state_has_block();
+        } /* for(j..) */
+      } /* for(i..) */
+      sink = sink + n;
+    });
+    double strided = time_us(n_scans, [&]() {
+      size_t n = 0;
+      const cds::cell2D* origin = view.origin();
+      auto xstride = view.strides()[0];
+      auto ystride = view.strides()[1];
+      for (size_t i = 0; i < view.shape()[0]; ++i) {
+        const cds::cell2D* row = origin + i * xstride;
+        for (size_t j = 0; j < view.shape()[1]; ++j) {
+          n += row[j * ystride].state_has_block();
+        } /* for(j..) */
+      } /* for(i..) */
+      sink = sink + n;
+    });
+    std::printf("%4zux%-3zu %14.2f %14.2f\n", dim, dim, nested, strided);
+  } /* for(dim..) */
+  return 0;
+} /* main() */
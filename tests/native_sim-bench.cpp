@@ -0,0 +1,179 @@
+/**
+ * \file native_sim-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdio>
+
+#include "cosm/hal/hal.hpp"
+
+#if COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "cosm/hal/actuators/diff_drive_actuator.hpp"
+#include "cosm/hal/actuators/led_actuator.hpp"
+#include "cosm/hal/actuators/wifi_actuator.hpp"
+#include "cosm/hal/native_sim/devices.hpp"
+#include "cosm/hal/native_sim/world.hpp"
+#include "cosm/hal/sensors/colored_blob_camera_sensor.hpp"
+#include "cosm/hal/sensors/diff_drive_sensor.hpp"
+#include "cosm/hal/sensors/light_sensor.hpp"
+#include "cosm/hal/sensors/position_sensor.hpp"
+#include "cosm/hal/sensors/proximity_sensor.hpp"
+#include "cosm/hal/sensors/wifi_sensor.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace chal = cosm::hal;
+namespace native = cosm::hal::native_sim;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+namespace rutils = rcppsw::utils;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Throughput of \ref native::world::run() for a swarm on a 100x100 grid of
+ * 0.9m spacing in a 100x100m arena with one light. Each robot's control step
+ * reads every sensor, sets its LEDs, broadcasts a wifi packet and sets its
+ * wheel speeds through the HAL wrappers, as a controller would.
+ */
+static constexpr size_t kRobots = 10000;
+static constexpr size_t kSteps = 100;
+
+/*******************************************************************************
+ * Benchmark Structures
+ ******************************************************************************/
+struct robot_devices {
+  robot_devices(native::world* const world, size_t id)
+      : prox(world, id),
+        light(world, id),
+        pos(world, id),
+        diff_drive(world, id),
+        camera(world, id),
+        wifi_rx(world, id),
+        wheels(world, id),
+        leds(world, id),
+        wifi_tx(world, id) {}
+
+  /* clang-format off */
+  native::proximity_sensor           prox;
+  native::light_sensor               light;
+  native::position_sensor            pos;
+  native::diff_drive_sensor          diff_drive;
+  native::colored_blob_camera_sensor camera;
+  native::wifi_sensor                wifi_rx;
+  native::diff_drive_actuator        wheels;
+  native::led_actuator               leds;
+  native::wifi_actuator              wifi_tx;
+  /* clang-format on */
+};
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+static void run(uint n_threads) {
+  cds::arena_grid grid(rmath::vector2d(100.0, 100.0),
+                       rtypes::discretize_ratio(0.1));
+  native::config::world_config config;
+  config.n_threads = n_threads;
+  native::world world(&config, &grid);
+  world.light_add(rmath::vector2d(50.0, 50.0));
+
+  std::vector<robot_devices> devices;
+  devices.reserve(kRobots);
+  for (size_t i = 0; i < kRobots; ++i) {
+    size_t id = world.robot_add(
+        rmath::vector2d(1.0 + (i % 100) * 0.9, 1.0 + (i / 100) * 0.9), 0.1 * i);
+    devices.emplace_back(&world, id);
+  } /* for(i..) */
+
+  chal::sensors::config::proximity_sensor_config prox_config;
+  std::atomic<size_t> seen{ 0 };
+  auto start = std::chrono::steady_clock::now();
+  world.run(kSteps, [&](size_t id) {
+    auto& d = devices[id];
+    chal::sensors::proximity_sensor prox(&d.prox, &prox_config);
+    chal::sensors::light_sensor light(&d.light);
+    chal::sensors::position_sensor pos(&d.pos);
+    chal::sensors::diff_drive_sensor diff_drive(&d.diff_drive);
+    chal::sensors::colored_blob_camera_sensor camera(&d.camera);
+    chal::sensors::wifi_sensor wifi_rx(&d.wifi_rx);
+    chal::actuators::diff_drive_actuator wheels(&d.wheels);
+    chal::actuators::led_actuator leds(&d.leds);
+    chal::actuators::wifi_actuator wifi_tx(&d.wifi_tx);
+
+    auto obs = prox.avg_prox_obj();
+    seen += light.readings().size() + camera.readings().size() +
+            wifi_rx.readings().size();
+    (void)pos.reading();
+    (void)diff_drive.current_speed();
+
+    chal::wifi_packet packet;
+    packet.data = { 1, 2, 3 };
+    wifi_tx.broadcast_start(packet);
+    leds.set_color(-1, rutils::color::kRED);
+    if (obs) {
+      wheels.set_wheel_speeds(0.05, 0.1);
+    } else {
+      wheels.set_wheel_speeds(0.1, 0.1);
+    }
+  });
+  double s = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                           start)
+                 .count();
+  std::printf("%8u %8zu %8zu %10.3f %12zu\n",
+              n_threads,
+              world.n_robots(),
+              world.steps(),
+              s,
+              static_cast<size_t>(seen));
+} /* run() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  std::printf("%8s %8s %8s %10s %12s\n",
+              "threads",
+              "robots",
+              "steps",
+              "s",
+              "seen");
+  for (uint n_threads : { 1U, 2U, 4U }) {
+    run(n_threads);
+  } /* for(n_threads..) */
+  return 0;
+} /* main() */
+
+#else
+
+int main(void) {
+  std::printf("native_sim-bench: requires COSM_HAL_TARGET=native-sim\n");
+  return 0;
+} /* main() */
+
+#endif /* COSM_HAL_TARGET == HAL_TARGET_NATIVE_SIM */
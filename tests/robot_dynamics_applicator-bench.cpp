@@ -0,0 +1,153 @@
+/**
+ * \file robot_dynamics_applicator-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <tuple>
+
+#include "cosm/tv/config/robot_dynamics_applicator_config.hpp"
+#include "cosm/tv/robot_dynamics_applicator.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace ctv = cosm::tv;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Per-tick motion throttler toggle + update for every robot in the swarm, with
+ * every 10th robot unregistered (e.g., killed by population dynamics), as done
+ * by \ref cosm::pal::tv::argos_rda_adaptor::update().
+ */
+static constexpr size_t kUpdatesPerRun = 10000000;
+static constexpr size_t kUnregisteredStride = 10;
+
+/*******************************************************************************
+ * Benchmark Classes
+ ******************************************************************************/
+/*
+ * The applicator under test, updated in the same two phases as in \ref
+ * cosm::pal::tv::argos_rda_adaptor::update().
+ */
+class bench_applicator final : public ctv::robot_dynamics_applicator {
+ public:
+  bench_applicator(const ctv::config::robot_dynamics_applicator_config* config,
+                   size_t n_robots)
+      : robot_dynamics_applicator(config), mc_n_robots(n_robots) {}
+
+  void update(void) override {
+    for (size_t i = 0; i < mc_n_robots; ++i) {
+      if (0 != i % kUnregisteredStride) {
+        motion_throttler(rtypes::type_uuid(static_cast<int>(i)))
+            ->toggle(0 != (i & 1));
+      }
+    } /* for(i..) */
+    motion_throttlers_update(m_t);
+    m_t = rtypes::timestep(m_t.v() + 1);
+  }
+  double avg_motion_throttle(void) const override { return 0.0; }
+
+ private:
+  /* clang-format off */
+  const size_t     mc_n_robots;
+  rtypes::timestep m_t{0};
+  /* clang-format on */
+};
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+/*
+ * The <ID, throttler> map storage that the ID-indexed storage replaced.
+ */
+static double run_map(const ctv::config::robot_dynamics_applicator_config* config,
+                      size_t n_robots) {
+  std::map<rtypes::type_uuid, ctv::switchable_tv_generator> throttlers;
+  for (size_t i = 0; i < n_robots; ++i) {
+    if (0 != i % kUnregisteredStride) {
+      throttlers.emplace(std::piecewise_construct,
+                         std::forward_as_tuple(static_cast<int>(i)),
+                         std::forward_as_tuple(&config->motion_throttle));
+    }
+  } /* for(i..) */
+
+  size_t n_ticks = kUpdatesPerRun / n_robots;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < n_ticks; ++t) {
+    for (size_t i = 0; i < n_robots; ++i) {
+      if (0 != i % kUnregisteredStride) {
+        auto& throttler = throttlers.at(rtypes::type_uuid(static_cast<int>(i)));
+        throttler.toggle(0 != (i & 1));
+        throttler.update(rtypes::timestep(t));
+      }
+    } /* for(i..) */
+  } /* for(t..) */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(n_ticks * n_robots);
+} /* run_map() */
+
+static double run_applicator(
+    const ctv::config::robot_dynamics_applicator_config* config,
+    size_t n_robots) {
+  bench_applicator applicator(config, n_robots);
+  for (size_t i = 0; i < n_robots; ++i) {
+    if (0 != i % kUnregisteredStride) {
+      applicator.register_controller(rtypes::type_uuid(static_cast<int>(i)));
+    }
+  } /* for(i..) */
+
+  size_t n_ticks = kUpdatesPerRun / n_robots;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < n_ticks; ++t) {
+    applicator.update();
+  } /* for(t..) */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(n_ticks * n_robots);
+} /* run_applicator() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  ctv::config::robot_dynamics_applicator_config config;
+  config.motion_throttle.type = "Sine";
+  config.motion_throttle.frequency = 0.01;
+  config.motion_throttle.amplitude = 0.5;
+  config.motion_throttle.offset = 0.5;
+
+  std::printf("%8s %16s %16s\n", "robots", "map ns/robot", "slots ns/robot");
+  for (size_t n_robots : { 1000, 10000, 100000 }) {
+    double map = run_map(&config, n_robots);
+    double slots = run_applicator(&config, n_robots);
+    std::printf("%8zu %16.1f %16.1f\n", n_robots, map, slots);
+  } /* for(n_robots..) */
+  return 0;
+} /* main() */
@@ -0,0 +1,190 @@
+/**
+ * \file robot_on_block-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "cosm/ds/arena_grid.hpp"
+#include "cosm/repr/cube_block2D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace crepr = cosm::repr;
+namespace rmath = rcppsw::math;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * The general case of \ref cosm::arena::base_arena_map::robot_on_block() (the
+ * robot is not on the block it thinks it is): searching the cells near the
+ * robot for host cells of blocks containing it, vs. the linear scan over all
+ * blocks it replaced. The arena map itself needs ARGoS, so the same search is
+ * done here on an \ref cds::arena_grid with blocks placed directly on it. Half
+ * the queries are on a block, half are at random points in the arena.
+ */
+static constexpr double kArenaDim = 80.0;
+static constexpr double kResolution = 0.2;
+static constexpr double kBlockDim = 0.2;
+static constexpr size_t kQueriesPerRun = 20000000;
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+/*
+ * Same window as \ref cosm::arena::base_arena_map::host_cell_search_bounds().
+ */
+static std::pair<rmath::vector2z, rmath::vector2z> search_bounds(
+    const cds::arena_grid& grid,
+    const rmath::vector2d& pos,
+    const rmath::vector2d& dims) {
+  auto lb = [&](double coord, double dim) {
+    return static_cast<size_t>(
+        std::max(0.0, std::floor((coord - dim / 2.0) / kResolution) - 1.0));
+  };
+  auto ub = [&](double coord, double dim, size_t dsize) {
+    return std::min(dsize - 1,
+                    static_cast<size_t>(std::max(
+                        0.0, std::ceil((coord + dim / 2.0) / kResolution) + 1.0)));
+  };
+  return { rmath::vector2z(lb(pos.x(), dims.x()), lb(pos.y(), dims.y())),
+           rmath::vector2z(ub(pos.x(), dims.x(), grid.xdsize()),
+                           ub(pos.y(), dims.y(), grid.ydsize())) };
+} /* search_bounds() */
+
+static rtypes::type_uuid indexed_search(const cds::arena_grid& grid,
+                                        const rmath::vector2d& pos) {
+  auto bounds = search_bounds(grid, pos, rmath::vector2d(kBlockDim, kBlockDim));
+  rtypes::type_uuid ret = rtypes::constants::kNoUUID;
+  grid.region_lock(bounds.first, bounds.second);
+  for (size_t i = bounds.first.x(); i <= bounds.second.x(); ++i) {
+    for (size_t j = bounds.first.y(); j <= bounds.second.y(); ++j) {
+      const auto& cell = grid.access<cds::arena_grid::kCell>(i, j);
+      if (!cell.state_has_block() || rtypes::constants::kNoUUID != ret) {
+        continue;
+      }
+      auto* block = dynamic_cast<const crepr::base_block2D*>(cell.entity());
+      if (nullptr != block && block->contains_point2D(pos)) {
+        ret = block->id();
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+  grid.region_unlock(bounds.first, bounds.second);
+  return ret;
+} /* indexed_search() */
+
+static rtypes::type_uuid linear_search(
+    const std::vector<std::unique_ptr<crepr::cube_block2D>>& blocks,
+    const rmath::vector2d& pos) {
+  for (auto& b : blocks) {
+    if (b->contains_point2D(pos)) {
+      return b->id();
+    }
+  } /* for(&b..) */
+  return rtypes::constants::kNoUUID;
+} /* linear_search() */
+
+template <typename TFunc>
+static double time_ns(const std::vector<rmath::vector2d>& queries,
+                      size_t n_queries,
+                      const TFunc& f) {
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n_queries; ++i) {
+    sink = sink + f(queries[i % queries.size()]).v();
+  } /* for(i..) */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(n_queries);
+} /* time_ns() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  /* 400x400 cells */
+  cds::arena_grid grid(rmath::vector2d(kArenaDim, kArenaDim),
+                       rtypes::discretize_ratio(kResolution));
+  std::mt19937 rng(17);
+
+  std::vector<rmath::vector2z> cells;
+  for (size_t i = 0; i < grid.xdsize(); ++i) {
+    for (size_t j = 0; j < grid.ydsize(); ++j) {
+      cells.emplace_back(i, j);
+    } /* for(j..) */
+  } /* for(i..) */
+
+  std::printf("%8s %14s %14s\n", "blocks", "linear ns", "indexed ns");
+  for (size_t n_blocks : { 100, 1000, 10000, 100000 }) {
+    grid.reset();
+    std::shuffle(cells.begin(), cells.end(), rng);
+
+    std::vector<std::unique_ptr<crepr::cube_block2D>> blocks;
+    for (size_t i = 0; i < n_blocks; ++i) {
+      blocks.push_back(std::make_unique<crepr::cube_block2D>(
+          rmath::vector2d(kBlockDim, kBlockDim),
+          rtypes::type_uuid(static_cast<int>(i))));
+      auto* block = blocks.back().get();
+      block->rloc(rmath::zvec2dvec(cells[i], kResolution));
+      block->dloc(cells[i]);
+      auto& cell = grid.access<cds::arena_grid::kCell>(cells[i]);
+      cell.entity(block);
+      cell.fsm().event_block_drop();
+    } /* for(i..) */
+
+    std::uniform_real_distribution<double> coord(0.0, kArenaDim);
+    std::uniform_int_distribution<size_t> which(0, n_blocks - 1);
+    std::vector<rmath::vector2d> queries;
+    for (size_t i = 0; i < 4096; ++i) {
+      if (0 == i % 2) {
+        queries.push_back(blocks[which(rng)]->rloc());
+      } else {
+        queries.emplace_back(coord(rng), coord(rng));
+      }
+    } /* for(i..) */
+
+    /* the linear scan is too slow to run as many queries with many blocks */
+    double linear = time_ns(queries,
+                            kQueriesPerRun / n_blocks,
+                            [&](const rmath::vector2d& pos) {
+                              return linear_search(blocks, pos);
+                            });
+    double indexed = time_ns(queries,
+                             kQueriesPerRun / 10,
+                             [&](const rmath::vector2d& pos) {
+                               return indexed_search(grid, pos);
+                             });
+    std::printf("%8zu %14.1f %14.1f\n", n_blocks, linear, indexed);
+  } /* for(n_blocks..) */
+  return 0;
+} /* main() */
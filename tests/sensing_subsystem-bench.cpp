@@ -0,0 +1,140 @@
+/**
+ * \file sensing_subsystem-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "cosm/subsystem/base_sensing_subsystem.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace chal = cosm::hal;
+namespace csubsystem = cosm::subsystem;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Sensor lookups by type, as made by robot controllers each timestep, across
+ * a swarm of sensing subsystems, via the tuple slots of \ref
+ * csubsystem::base_sensing_subsystem vs. the <typeid, variant> map it is
+ * constructed from (which is how sensors used to be stored). Sensors are
+ * created from NULL device handles and never read, so only lookup is timed.
+ */
+static constexpr size_t kRobots = 10000;
+static constexpr size_t kTicks = 100;
+
+/*******************************************************************************
+ * Benchmark Classes
+ ******************************************************************************/
+class bench_subsystem final : public csubsystem::base_sensing_subsystem {
+ public:
+  using base_sensing_subsystem::base_sensing_subsystem;
+
+  void update(const rtypes::timestep&, const rtypes::discretize_ratio&) override {}
+};
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+static csubsystem::base_sensing_subsystem::sensor_map sensors_create(
+    const chal::sensors::config::proximity_sensor_config* prox,
+    const chal::sensors::config::ground_sensor_config* ground) {
+  using subsystem = csubsystem::base_sensing_subsystem;
+  return {
+    subsystem::map_entry_create(chal::sensors::proximity_sensor(nullptr, prox)),
+    subsystem::map_entry_create(chal::sensors::wifi_sensor(nullptr)),
+    subsystem::map_entry_create(
+        chal::sensors::colored_blob_camera_sensor(nullptr)),
+    subsystem::map_entry_create(chal::sensors::light_sensor(nullptr)),
+    subsystem::map_entry_create(chal::sensors::ground_sensor(nullptr, ground)),
+    subsystem::map_entry_create(chal::sensors::battery_sensor(nullptr)),
+    subsystem::map_entry_create(chal::sensors::diff_drive_sensor(nullptr))
+  };
+} /* sensors_create() */
+
+template <typename TFunc>
+static double time_ns(const TFunc& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < kTicks; ++t) {
+    for (size_t i = 0; i < kRobots; ++i) {
+      f(i);
+    } /* for(i..) */
+  } /* for(t..) */
+  /* 4 lookups per robot per tick */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(kTicks * kRobots * 4);
+} /* time_ns() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  chal::sensors::config::proximity_sensor_config prox;
+  chal::sensors::config::ground_sensor_config ground;
+  volatile size_t sink = 0;
+
+  std::vector<csubsystem::base_sensing_subsystem::sensor_map> maps;
+  std::vector<std::unique_ptr<bench_subsystem>> subsystems;
+  for (size_t i = 0; i < kRobots; ++i) {
+    maps.push_back(sensors_create(&prox, &ground));
+    subsystems.push_back(std::make_unique<bench_subsystem>(
+        chal::sensors::position_sensor(nullptr), maps.back()));
+  } /* for(i..) */
+
+  /* sensor addresses are accumulated so lookups are not optimized away */
+  auto addr = [](const auto* sensor) {
+    return reinterpret_cast<uintptr_t>(sensor);
+  };
+  double map_ns = time_ns([&](size_t i) {
+    const auto& sensors = maps[i];
+    auto lookup = [&](auto* type) {
+      using sensor_type = std::remove_pointer_t<decltype(type)>;
+      return addr(&boost::get<sensor_type>(sensors.at(typeid(sensor_type))));
+    };
+    sink = sink + lookup(static_cast<chal::sensors::proximity_sensor*>(nullptr)) +
+           lookup(static_cast<chal::sensors::light_sensor*>(nullptr)) +
+           lookup(static_cast<chal::sensors::ground_sensor*>(nullptr)) +
+           lookup(static_cast<chal::sensors::diff_drive_sensor*>(nullptr));
+  });
+  double slots_ns = time_ns([&](size_t i) {
+    const auto* saa = subsystems[i].get();
+    sink = sink + addr(saa->sensor<chal::sensors::proximity_sensor>()) +
+           addr(saa->sensor<chal::sensors::light_sensor>()) +
+           addr(saa->sensor<chal::sensors::ground_sensor>()) +
+           addr(saa->sensor<chal::sensors::diff_drive_sensor>());
+  });
+
+  std::printf("robots=%zu ticks=%zu\n", kRobots, kTicks);
+  std::printf("map + variant: %.1f ns/lookup\n", map_ns);
+  std::printf("tuple slots:   %.1f ns/lookup\n", slots_ns);
+  return 0;
+} /* main() */
@@ -0,0 +1,141 @@
+/**
+ * \file swap_remove_map-test.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_PREFIX_ALL
+#include "cosm/ds/swap_remove_map.hpp"
+#include <catch.hpp>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cds = cosm::ds;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Test Helpers
+ ******************************************************************************/
+/*
+ * Every element must be reachable through its ID, and the ID -> position index
+ * must agree with the positions of the elements.
+ */
+template<typename T>
+static void require_consistent(const cds::swap_remove_map<T>& map) {
+  for (size_t i = 0; i < map.size(); ++i) {
+    CATCH_REQUIRE(map.contains(map[i].first));
+    CATCH_REQUIRE(&map[i].second == map.find(map[i].first));
+  } /* for(i..) */
+}
+
+/*******************************************************************************
+ * Test Functions
+ ******************************************************************************/
+CATCH_TEST_CASE("insert-test", "[swap_remove_map]") {
+  cds::swap_remove_map<int> map;
+  CATCH_REQUIRE(map.empty());
+
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(3), 30));
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(7), 70));
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(7)));
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(5)));
+  CATCH_REQUIRE(nullptr == map.find(rtypes::type_uuid(5)));
+  CATCH_REQUIRE(3 == map[0].first.v());
+  CATCH_REQUIRE(30 == map[0].second);
+  CATCH_REQUIRE(7 == map[1].first.v());
+  CATCH_REQUIRE(70 == map[1].second);
+  require_consistent(map);
+}
+
+CATCH_TEST_CASE("duplicate-insert-test", "[swap_remove_map]") {
+  cds::swap_remove_map<int> map;
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(3), 30));
+
+  /* a duplicate ID is rejected and does not overwrite the existing value */
+  CATCH_REQUIRE(!map.insert(rtypes::type_uuid(3), 31));
+  CATCH_REQUIRE(1 == map.size());
+  CATCH_REQUIRE(30 == map[0].second);
+
+  /* ...and removing it once removes it completely */
+  CATCH_REQUIRE(map.remove(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(map.empty());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(3)));
+}
+
+CATCH_TEST_CASE("remove-test", "[swap_remove_map]") {
+  cds::swap_remove_map<int> map;
+  for (int i = 0; i < 5; ++i) {
+    CATCH_REQUIRE(map.insert(rtypes::type_uuid(i), i * 10));
+  } /* for(i..) */
+
+  /* not present */
+  CATCH_REQUIRE(!map.remove(rtypes::type_uuid(17)));
+  CATCH_REQUIRE(5 == map.size());
+
+  /* last element: nothing to swap */
+  CATCH_REQUIRE(map.remove(rtypes::type_uuid(4)));
+  CATCH_REQUIRE(4 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(4)));
+  require_consistent(map);
+
+  /* middle element: the last element is swapped into its position */
+  CATCH_REQUIRE(map.remove(rtypes::type_uuid(1)));
+  CATCH_REQUIRE(3 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(1)));
+  CATCH_REQUIRE(3 == map[1].first.v());
+  CATCH_REQUIRE(30 == map[1].second);
+  require_consistent(map);
+
+  /* the swapped element's index was fixed up, so it can still be removed */
+  CATCH_REQUIRE(map.remove(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(0 == map[0].first.v());
+  CATCH_REQUIRE(2 == map[1].first.v());
+  require_consistent(map);
+
+  /* first element */
+  CATCH_REQUIRE(map.remove(rtypes::type_uuid(0)));
+  CATCH_REQUIRE(1 == map.size());
+  CATCH_REQUIRE(2 == map[0].first.v());
+  CATCH_REQUIRE(20 == map[0].second);
+  require_consistent(map);
+
+  /* removed IDs can be re-added */
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(1), 11));
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(1 == map[1].first.v());
+  require_consistent(map);
+}
+
+CATCH_TEST_CASE("clear-test", "[swap_remove_map]") {
+  cds::swap_remove_map<int> map;
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(1), 10));
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(2), 20));
+  map.clear();
+  CATCH_REQUIRE(map.empty());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(1)));
+  CATCH_REQUIRE(map.insert(rtypes::type_uuid(1), 10));
+  CATCH_REQUIRE(1 == map.size());
+}
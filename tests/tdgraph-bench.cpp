@@ -0,0 +1,179 @@
+/**
+ * \file tdgraph-bench.cpp
+ *
+ * \copyright 2021 John Harwell, All rights reserved.
+ *
+ * This file is part of COSM.
+ *
+ * COSM is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * COSM is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * COSM.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "cosm/ta/config/task_alloc_config.hpp"
+#include "cosm/ta/ds/tdgraph.hpp"
+#include "cosm/ta/polled_task.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace cta = cosm::ta;
+namespace rtypes = rcppsw::types;
+
+/*******************************************************************************
+ * Constants
+ ******************************************************************************/
+/*
+ * Queries made on full binary task decomposition graphs of increasing depth:
+ * building the ID-indexed task vector the allocator needs, vertex
+ * ID/depth/parent of a task, and finding a task by name.
+ */
+static constexpr size_t kQueriesPerRun = 2000000;
+
+/*******************************************************************************
+ * Benchmark Classes
+ ******************************************************************************/
+class bench_task final : public cta::polled_task {
+ public:
+  bench_task(const std::string& name,
+             const cta::config::task_alloc_config* config)
+      : polled_task(name, &config->abort, &config->exec_est.ema, nullptr) {}
+
+  rtypes::timestep current_time(void) const override {
+    return rtypes::timestep(0);
+  }
+  void task_start(const cta::taskable_argument*) override {}
+  bool task_completed(void) const override { return false; }
+  double abort_prob_calc(void) override { return 0.0; }
+  rtypes::timestep interface_time_calc(uint,
+                                       const rtypes::timestep&) override {
+    return rtypes::timestep(0);
+  }
+  void active_interface_update(int) override {}
+};
+
+/*******************************************************************************
+ * Benchmark Functions
+ ******************************************************************************/
+static void build(cta::ds::tdgraph* graph,
+                  const cta::config::task_alloc_config* config,
+                  size_t depth) {
+  size_t n_tasks = 0;
+  graph->set_root(
+      std::make_unique<bench_task>("t" + std::to_string(n_tasks++), config));
+  std::vector<const cta::polled_task*> frontier{ graph->root() };
+  for (size_t d = 0; d < depth; ++d) {
+    std::vector<const cta::polled_task*> next;
+    for (const auto* parent : frontier) {
+      cta::ds::tdgraph::vertex_vector kids;
+      for (size_t k = 0; k < 2; ++k) {
+        kids.push_back(std::make_unique<bench_task>(
+            "t" + std::to_string(n_tasks++), config));
+        next.push_back(kids.back().get());
+      } /* for(k..) */
+      graph->set_children(parent, std::move(kids));
+    } /* for(*parent..) */
+    frontier = next;
+  } /* for(d..) */
+} /* build() */
+
+template <typename TFunc>
+static double time_ns(size_t n_iters, const TFunc& f) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n_iters; ++i) {
+    f(i);
+  } /* for(i..) */
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         static_cast<double>(n_iters);
+} /* time_ns() */
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+int main(void) {
+  cta::config::task_alloc_config config;
+  volatile size_t sink = 0;
+
+  std::printf("%6s %14s %14s %14s %14s %14s\n",
+              "tasks",
+              "walk vec ns",
+              "tasks() ns",
+              "id+depth+par",
+              "name scan ns",
+              "name map ns");
+  for (size_t depth : { 3, 6, 9 }) {
+    cta::ds::tdgraph graph;
+    build(&graph, &config, depth);
+    size_t n_tasks = graph.n_vertices();
+    size_t n_allocs = kQueriesPerRun / n_tasks + 1;
+
+    /* what bi_tdgraph_allocator did on every allocation */
+    double walk_vec = time_ns(n_allocs, [&](size_t) {
+      std::vector<cta::polled_task*> tasks(n_tasks);
+      graph.walk([&](cta::polled_task* task) {
+        tasks[static_cast<size_t>(graph.vertex_id(task))] = task;
+      });
+      sink = sink + tasks.size();
+    });
+    double tasks_vec = time_ns(n_allocs, [&](size_t) {
+      sink = sink + graph.tasks().size();
+    });
+
+    double queries = time_ns(kQueriesPerRun, [&](size_t i) {
+      const auto* task = graph.tasks()[(i * 7919) % n_tasks];
+      sink = sink + static_cast<size_t>(graph.vertex_id(task)) +
+             static_cast<size_t>(graph.vertex_depth(task)) +
+             (nullptr != graph.vertex_parent(task));
+    });
+
+    /*
+     * What find_vertex(name) did: a linear scan comparing names (which stopped
+     * at the first match, while walk() always visits every task).
+     */
+    std::vector<std::string> names;
+    for (const auto* task : graph.tasks()) {
+      names.push_back(task->name());
+    } /* for(*task..) */
+    size_t n_scans = kQueriesPerRun / n_tasks + 1;
+    double name_scan = time_ns(n_scans, [&](size_t i) {
+      const auto& name = names[(i * 7919) % n_tasks];
+      const cta::polled_task* found = nullptr;
+      graph.walk([&](const cta::polled_task* task) {
+        if (nullptr == found && name == task->name()) {
+          found = task;
+        }
+      });
+      sink = sink + (nullptr != found);
+    });
+    double name_map = time_ns(kQueriesPerRun, [&](size_t i) {
+      sink = sink + (nullptr != graph.find_vertex(names[(i * 7919) % n_tasks]));
+    });
+
+    std::printf("%6zu %14.1f %14.1f %14.1f %14.1f %14.1f\n",
+                n_tasks,
+                walk_vec,
+                tasks_vec,
+                queries,
+                name_scan,
+                name_map);
+  } /* for(depth..) */
+  return 0;
+} /* main() */
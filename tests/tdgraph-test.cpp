@@ -23,66 +23,221 @@
  ******************************************************************************/
 #define CATCH_CONFIG_MAIN
 #define CATCH_CONFIG_PREFIX_ALL
-#include "rcppsw/ta/polled_task.hpp"
-#include "rcppsw/ta/tdgraph.hpp"
-#include "rcppsw/ta/config/task_alloc_config.hpp"
+#include "cosm/ta/polled_task.hpp"
+#include "cosm/ta/ds/tdgraph.hpp"
+#include "cosm/ta/config/task_alloc_config.hpp"
 #include <catch.hpp>
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
-namespace ta = rcppsw::ta;
-namespace er = rcppsw::er;
+namespace cta = cosm::ta;
+namespace rtypes = rcppsw::types;
 
 /*******************************************************************************
  * Test Classes
  ******************************************************************************/
-class test_task : public ta::polled_task {
+class test_task : public cta::polled_task {
  public:
   test_task(const std::string &name,
-            const struct ta::config::task_alloc_config *c_config)
+            const struct cta::config::task_alloc_config *c_config)
       : polled_task(name, &c_config->abort, &c_config->exec_est.ema, nullptr) {}
 
-  double current_time(void) const override { return 0.0; }
-  void task_start(const ta::taskable_argument*) override {}
+  rtypes::timestep current_time(void) const override { return rtypes::timestep(0); }
+  void task_start(const cta::taskable_argument*) override {}
   bool task_completed(void) const override { return false; }
   double abort_prob_calc(void) override { return 0.0; }
-  double interface_time_calc(uint, double) override { return 0.0; }
+  rtypes::timestep interface_time_calc(uint, const rtypes::timestep&) override {
+    return rtypes::timestep(0);
+  }
   void active_interface_update(int) override {}
-
 };
 
+/*******************************************************************************
+ * Test Helpers
+ ******************************************************************************/
+/*
+ * root_task -> {subtask1, subtask2}, subtask1 -> {subtask3, subtask4}
+ */
+static void build(cta::ds::tdgraph* g,
+                  const cta::config::task_alloc_config* config) {
+  CATCH_REQUIRE(OK == g->set_root(std::make_unique<test_task>("root_task", config)));
+
+  cta::ds::tdgraph::vertex_vector vec1;
+  vec1.push_back(std::make_unique<test_task>("subtask1", config));
+  vec1.push_back(std::make_unique<test_task>("subtask2", config));
+  cta::ds::tdgraph::vertex_vector vec2;
+  vec2.push_back(std::make_unique<test_task>("subtask3", config));
+  vec2.push_back(std::make_unique<test_task>("subtask4", config));
+  CATCH_REQUIRE(OK == g->set_children("root_task", std::move(vec1)));
+  CATCH_REQUIRE(OK == g->set_children("subtask1", std::move(vec2)));
+}
+
+/*
+ * Every task is reachable by name and by ID, and its recorded ID matches its
+ * position in the graph.
+ */
+static void require_ids(const cta::ds::tdgraph& g) {
+  CATCH_REQUIRE(g.tasks().size() == g.n_vertices());
+  for (size_t i = 0; i < g.n_vertices(); ++i) {
+    const auto* task = g.find_vertex(static_cast<int>(i));
+    CATCH_REQUIRE(task == g.tasks()[i]);
+    CATCH_REQUIRE(task == g.find_vertex(task->name()));
+    CATCH_REQUIRE(static_cast<int>(i) == task->vertex_id());
+    CATCH_REQUIRE(static_cast<int>(i) == g.vertex_id(task));
+  } /* for(i..) */
+}
+
 /*******************************************************************************
  * Test Functions
  ******************************************************************************/
 CATCH_TEST_CASE("sanity-test", "[tdgraph]") {
-  ta::tdgraph g;
+  cta::ds::tdgraph g;
 }
 CATCH_TEST_CASE("build-test", "[tdgraph]") {
-  ta::tdgraph g;
-  ta::config::task_alloc_config config;
-  CATCH_REQUIRE(OK == g.set_root(rcppsw::make_unique<test_task>("root_task", &config)));
+  cta::ds::tdgraph g;
+  cta::config::task_alloc_config config;
+  CATCH_REQUIRE(OK == g.set_root(std::make_unique<test_task>("root_task", &config)));
   CATCH_REQUIRE(g.root()->name() == "root_task");
 
-  auto subtask1 = rcppsw::make_unique<test_task>("subtask1", &config);
-  auto subtask2 = rcppsw::make_unique<test_task>("subtask2", &config);
-  auto subtask3 = rcppsw::make_unique<test_task>("subtask3", &config);
-  auto subtask4 = rcppsw::make_unique<test_task>("subtask4", &config);
-  ta::tdgraph::vertex_vector vec1;
+  auto subtask1 = std::make_unique<test_task>("subtask1", &config);
+  auto subtask2 = std::make_unique<test_task>("subtask2", &config);
+  auto subtask3 = std::make_unique<test_task>("subtask3", &config);
+  auto subtask4 = std::make_unique<test_task>("subtask4", &config);
+  cta::ds::tdgraph::vertex_vector vec1;
   vec1.push_back(std::move(subtask1));
   vec1.push_back(std::move(subtask2));
-  ta::tdgraph::vertex_vector vec2;
+  cta::ds::tdgraph::vertex_vector vec2;
   vec2.push_back(std::move(subtask3));
   vec2.push_back(std::move(subtask4));
   CATCH_REQUIRE(OK == g.set_children("root_task", std::move(vec1)));
   CATCH_REQUIRE(OK == g.set_children("subtask1", std::move(vec2)));
   CATCH_REQUIRE(g.root()->name() == "root_task");
-  CATCH_REQUIRE(ta::tdgraph::vertex_parent(g,
-                                           g.find_vertex("subtask1"))->name() == "root_task");
-  CATCH_REQUIRE(ta::tdgraph::vertex_parent(g,
-                                           g.find_vertex("subtask2"))->name() == "root_task");
-  CATCH_REQUIRE(ta::tdgraph::vertex_parent(g, g.find_vertex("subtask3"))->name() ==
+  CATCH_REQUIRE(cta::ds::tdgraph::vertex_parent(g,
+                                                g.find_vertex("subtask1"))->name() == "root_task");
+  CATCH_REQUIRE(cta::ds::tdgraph::vertex_parent(g,
+                                                g.find_vertex("subtask2"))->name() == "root_task");
+  CATCH_REQUIRE(cta::ds::tdgraph::vertex_parent(g, g.find_vertex("subtask3"))->name() ==
                 "subtask1");
-  CATCH_REQUIRE(ta::tdgraph::vertex_parent(g, g.find_vertex("subtask4"))->name() ==
+  CATCH_REQUIRE(cta::ds::tdgraph::vertex_parent(g, g.find_vertex("subtask4"))->name() ==
                 "subtask1");
 }
+
+CATCH_TEST_CASE("id-depth-parent-test", "[tdgraph]") {
+  cta::ds::tdgraph g;
+  cta::config::task_alloc_config config;
+  build(&g, &config);
+
+  CATCH_REQUIRE(5 == g.n_vertices());
+  require_ids(g);
+
+  /* IDs are assigned in the order tasks are added */
+  CATCH_REQUIRE(0 == g.vertex_id(g.find_vertex("root_task")));
+  CATCH_REQUIRE(1 == g.vertex_id(g.find_vertex("subtask1")));
+  CATCH_REQUIRE(2 == g.vertex_id(g.find_vertex("subtask2")));
+  CATCH_REQUIRE(3 == g.vertex_id(g.find_vertex("subtask3")));
+  CATCH_REQUIRE(4 == g.vertex_id(g.find_vertex("subtask4")));
+
+  CATCH_REQUIRE(0 == g.vertex_depth(g.find_vertex("root_task")));
+  CATCH_REQUIRE(1 == g.vertex_depth(g.find_vertex("subtask1")));
+  CATCH_REQUIRE(1 == g.vertex_depth(g.find_vertex("subtask2")));
+  CATCH_REQUIRE(2 == g.vertex_depth(g.find_vertex("subtask3")));
+  CATCH_REQUIRE(2 == g.vertex_depth(g.find_vertex("subtask4")));
+
+  /* only the root is its own parent */
+  CATCH_REQUIRE(g.root() == g.vertex_parent(g.root()));
+  CATCH_REQUIRE(g.root() == g.vertex_parent(g.find_vertex("subtask2")));
+  CATCH_REQUIRE(g.find_vertex("subtask1") ==
+                g.vertex_parent(g.find_vertex("subtask4")));
+}
+
+CATCH_TEST_CASE("set-children-test", "[tdgraph]") {
+  cta::ds::tdgraph g;
+  cta::config::task_alloc_config config;
+  build(&g, &config);
+
+  /* no such parent */
+  CATCH_REQUIRE(nullptr == g.find_vertex("subtask5"));
+  cta::ds::tdgraph::vertex_vector vec1;
+  vec1.push_back(std::make_unique<test_task>("subtask6", &config));
+  CATCH_REQUIRE(ERROR == g.set_children("subtask5", std::move(vec1)));
+  CATCH_REQUIRE(5 == g.n_vertices());
+
+  /* non-root tasks can only have their children set once */
+  cta::ds::tdgraph::vertex_vector vec2;
+  vec2.push_back(std::make_unique<test_task>("subtask6", &config));
+  CATCH_REQUIRE(ERROR == g.set_children("subtask1", std::move(vec2)));
+  CATCH_REQUIRE(5 == g.n_vertices());
+  CATCH_REQUIRE(nullptr == g.find_vertex("subtask6"));
+
+  auto kids = g.children(g.find_vertex("subtask1"));
+  CATCH_REQUIRE(2 == kids.size());
+  CATCH_REQUIRE("subtask3" == kids[0]->name());
+  CATCH_REQUIRE("subtask4" == kids[1]->name());
+
+  /* children added later get the next IDs and are found by name */
+  cta::ds::tdgraph::vertex_vector vec3;
+  vec3.push_back(std::make_unique<test_task>("subtask5", &config));
+  CATCH_REQUIRE(OK == g.set_children(g.find_vertex("subtask2"), std::move(vec3)));
+  CATCH_REQUIRE(6 == g.n_vertices());
+  CATCH_REQUIRE(5 == g.vertex_id(g.find_vertex("subtask5")));
+  CATCH_REQUIRE(2 == g.vertex_depth(g.find_vertex("subtask5")));
+  CATCH_REQUIRE(g.find_vertex("subtask2") ==
+                g.vertex_parent(g.find_vertex("subtask5")));
+  require_ids(g);
+}
+
+CATCH_TEST_CASE("foreign-vertex-test", "[tdgraph]") {
+  cta::ds::tdgraph g1;
+  cta::ds::tdgraph g2;
+  cta::config::task_alloc_config config;
+  build(&g1, &config);
+  build(&g2, &config);
+
+  /* same name and ID, but not the same task */
+  const auto* task = g2.find_vertex("subtask3");
+  CATCH_REQUIRE(3 == task->vertex_id());
+  CATCH_REQUIRE(-1 == g1.vertex_id(task));
+  CATCH_REQUIRE(-1 == g1.vertex_depth(task));
+  CATCH_REQUIRE(nullptr == g1.vertex_parent(task));
+
+  /* never added to a graph */
+  test_task orphan("orphan", &config);
+  CATCH_REQUIRE(-1 == orphan.vertex_id());
+  CATCH_REQUIRE(-1 == g1.vertex_id(&orphan));
+}
+
+CATCH_TEST_CASE("copy-test", "[tdgraph]") {
+  cta::ds::tdgraph g1;
+  cta::config::task_alloc_config config;
+  build(&g1, &config);
+
+  /* copies share tasks, and all queries work the same on them */
+  cta::ds::tdgraph g2(g1);
+  require_ids(g2);
+  CATCH_REQUIRE(g1.root() == g2.root());
+  for (const auto* task : g1.tasks()) {
+    CATCH_REQUIRE(task == g2.find_vertex(task->name()));
+    CATCH_REQUIRE(g1.vertex_id(task) == g2.vertex_id(task));
+    CATCH_REQUIRE(g1.vertex_depth(task) == g2.vertex_depth(task));
+    CATCH_REQUIRE(g1.vertex_parent(task) == g2.vertex_parent(task));
+  } /* for(*task..) */
+
+  /* adding tasks to one copy does not affect the other */
+  cta::ds::tdgraph::vertex_vector vec1;
+  vec1.push_back(std::make_unique<test_task>("subtask5", &config));
+  CATCH_REQUIRE(OK == g2.set_children("subtask2", std::move(vec1)));
+  CATCH_REQUIRE(6 == g2.n_vertices());
+  CATCH_REQUIRE(5 == g1.n_vertices());
+  CATCH_REQUIRE(nullptr != g2.find_vertex("subtask5"));
+  CATCH_REQUIRE(nullptr == g1.find_vertex("subtask5"));
+  CATCH_REQUIRE(-1 == g1.vertex_id(g2.find_vertex("subtask5")));
+
+  cta::ds::tdgraph::vertex_vector vec2;
+  vec2.push_back(std::make_unique<test_task>("subtask6", &config));
+  CATCH_REQUIRE(OK == g1.set_children("subtask2", std::move(vec2)));
+  CATCH_REQUIRE(nullptr == g2.find_vertex("subtask6"));
+  CATCH_REQUIRE(-1 == g2.vertex_id(g1.find_vertex("subtask6")));
+  require_ids(g1);
+  require_ids(g2);
+}